@@ -0,0 +1,48 @@
+/*
+ *  This file is part of aint.
+ *
+ *  aint provides a C++ class for arbitrary long integers which can be
+ *  used the same way as the C/C++ integer types (e.g. int or long),
+ *  but has no restriction on the length (if there is enough memory).
+ *  Aim of this project is to include fast integer multiplications
+ *  like the Toom-Cook algorithm or the Schoenhage-Strassen algorithm.
+ *  Copyright (C) 2014 Mario Baumann (mario-baumann@web.de)
+ *
+ *  aint is free software: you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  aint is distributed in the hope that it will be useful, but
+ *  WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with aint.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************/
+
+// arbitrary long integer
+// aint_barrett.cxx (reduction by a fixed modulus)
+
+#include "impl.hxx"
+
+namespace astd {
+
+aint::barrett::barrett(const aint& m) : modulus_(m) {
+    if (m == 0) {
+        throw std::overflow_error("Divide by zero");
+    }
+    // reciprocal_ = floor(B^2n / abs(m)), where m has n single components
+    aint v(m);
+    v.pimpl()->positive_ = true;
+    impl::shiftComps(aint(1), 2 * static_cast<long>(m.pimpl()->data_.size()), this->reciprocal_);
+    this->reciprocal_ /= v;
+}
+
+const aint& aint::barrett::modulus() const {
+    return(this->modulus_);
+}
+
+} // end of namespace astd
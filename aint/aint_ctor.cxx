@@ -27,15 +27,18 @@
 // aint_ctor.cxx (constructors)
 
 #include "impl.hxx"
+#include <cstring> // std::strlen
 
 namespace astd {
 
 // ctor(s)
 aint::aint() : impl_(new impl()) {
 }
-aint::aint(const char* s) : impl_(new impl(s)) {
+aint::aint(const char* s) : impl_(impl::create(s == NULL ? 1 : std::strlen(s) / impl::C_DECIMAL_WIDTH + 1)) {
+    pimpl()->ctorC(s);
 }
-aint::aint(const std::string& s) : impl_(new impl(s)) {
+aint::aint(const std::string& s) : impl_(impl::create(s.size() / impl::C_DECIMAL_WIDTH + 1)) {
+    pimpl()->ctorC(s.c_str());
 }
 aint::aint(const int i) : impl_(new impl(i)) {
 }
@@ -49,8 +52,9 @@ aint::aint(const unsigned long int i) : impl_(new impl(i)) {
 }
 aint::aint(const unsigned long long int i) : impl_(new impl(i)) {
 }
-aint::aint(const aint& a) : impl_(new impl(*a.impl_)) {
+aint::aint(const aint& a) : impl_(impl::create(*a.pimpl())) {
 }
-aint::aint(aint&& a) : impl_(std::move(a.impl_)) {
+aint::aint(aint&& a) noexcept : impl_(std::move(a.impl_)) {
+    // the moved-from aint has no impl and is zero (see pimpl)
 }
 } // end of namespace astd
@@ -33,4 +33,8 @@ namespace astd {
 aint::~aint() { 
 }
 
+void aint::implDeleter::operator()(impl* p) const {
+    impl::destroy(p);
+}
+
 } // end of namespace astd
@@ -27,21 +27,22 @@
 // aint_member.cxx (members)
 
 #include "impl.hxx"
+#include <cmath>   // std::log10, std::floor, std::fabs
 #include <iomanip>
 
 namespace astd {
 
 std::string aint::dump() const {
-    size_t dim = this->impl_->data_.size();
+    size_t dim = this->pimpl()->data_.size();
     std::stringstream ss;
     ss << "dump(\n";
-    ss << "  sc(w/m+1). " << (int) this->impl_->C_SINGLE_COMP_WIDTH << " / " << (int) this->impl_->C_SINGLE_COMP_MAX_P1 << "\n";
-    ss << "  positive.. " << std::boolalpha << this->impl_->positive_ << "\n";
+    ss << "  sc(w/m+1). " << (int) this->pimpl()->C_SINGLE_COMP_WIDTH << " / " << (long long int) this->pimpl()->C_SINGLE_COMP_MAX_P1 << "\n";
+    ss << "  positive.. " << std::boolalpha << this->pimpl()->positive_ << "\n";
     ss << "  dim....... " << dim << "\n";
     ss << "  data...... \n";
     int j = dim;
-    for (auto rit = this->impl_->data_.crbegin(); rit != this->impl_->data_.crend(); ++rit) {
-        ss << "    [" << std::setw(3) << j << "]... " << (int) *rit << "\n";
+    for (auto rit = this->pimpl()->data_.crbegin(); rit != this->pimpl()->data_.crend(); ++rit) {
+        ss << "    [" << std::setw(3) << j << "]... " << (long long int) *rit << "\n";
         --j;
     }
     ss << ")";
@@ -51,50 +52,119 @@ std::string aint::dump() const {
 
 int aint::digits() const {
     // returns the number of digits 'd' for the current aint
-    // d = digits of data[dim - 1] + C_SINGLE_COMP_WIDTH * (dim - 1)
-    size_t dim = this->impl_->data_.size();
-    aint::impl::singleComp t = this->impl_->data_[dim - 1];
-    int d = aint::impl::C_SINGLE_COMP_WIDTH * (dim - 1);
-    //
-    if (t < 10) return(d + 1);
-    if (t < 100) return(d + 2);
-#if defined(SINGLE_8)
-    return(d + 3);
-#else
-    if (t < 1000) return(d + 3);
-    if (t < 10000) return(d + 4);
-#if defined(SINGLE_16)
-    return(d + 5);
+    size_t dim = this->pimpl()->data_.size();
+    aint::impl::singleComp t = this->pimpl()->data_[dim - 1];
+#if defined(BINARY_RADIX)
+    if (dim == 1) {
+        int d = 1;
+        for (; t >= 10; t /= 10) {
+            ++d;
+        }
+        return(d);
+    }
+    // l = log10(abs(a)) from the leading single components (at least 60 bits, so
+    // that its error stays far below eps), the digits are floor(l) + 1; only if l
+    // is that close to an integer d, abs(a) is compared with 10^d
+    // NOTE: 0.30102999566398120 ~= log10(2)
+    const double B = static_cast<double>(aint::impl::C_SINGLE_COMP_MAX_P1);
+    double x = 0;
+    size_t j = dim;
+    while (j > 0 && x < 1e18) {
+        x = x * B + static_cast<double>(this->pimpl()->data_[--j]);
+    }
+    double l = std::log10(x) + aint::impl::C_SINGLE_COMP_WIDTH * 0.30102999566398120 * j;
+    double eps = 1e-9 + 1e-14 * l;
+    int d = static_cast<int>(std::floor(l + 0.5));
+    if (std::fabs(l - d) > eps) {
+        return(static_cast<int>(std::floor(l)) + 1);
+    }
+    return(this->pimpl()->operatorLtAbs(*this, aint(10).power(d)) ? d : d + 1);
 #else
-    if (t < 100000) return(d + 5);
-    if (t < 1000000) return(d + 6);
-    if (t < 10000000) return(d + 7);
-    if (t < 100000000) return(d + 8);
-    if (t < 1000000000) return(d + 9);
-    return(d + 10);
-#endif
+    // d = digits of data[dim - 1] + C_SINGLE_COMP_WIDTH * (dim - 1)
+    int d = aint::impl::C_SINGLE_COMP_WIDTH * (dim - 1) + 1;
+    for (; t >= 10; t /= 10) {
+        ++d;
+    }
+    return(d);
 #endif
 }
 
 bool aint::even() const {
     // returns true if the aint is even and otherwise false
-    return((this->impl_->data_[0]) % 2 == 0);
+    return((this->pimpl()->data_[0]) % 2 == 0);
 }
 
 aint aint::factorial() {
     if (*this < 100) {
-        return(this->impl_->factorialIterative(*this));
+        return(this->pimpl()->factorialIterative(*this));
     }
-    return(this->impl_->factorialRecursiveProduct(1, *this));
+    return(this->pimpl()->factorialRecursiveProduct(1, *this));
 }
 
 aint aint::power(const aint& exp) {
-    return(this->impl_->operatorPower(*this, exp));
+    return(this->pimpl()->operatorPower(*this, exp));
 }
 
 aint aint::powertower(const aint& ord) {
-    return(this->impl_->operatorPowerTower(*this, ord));
+    return(this->pimpl()->operatorPowerTower(*this, ord));
+}
+
+aint aint::powmod(const aint& exp, const aint& mod) const {
+    return(this->pimpl()->operatorPowerModulo(*this, exp, mod));
+}
+
+void aint::reserve(size_t digits) {
+    // C_DECIMAL_WIDTH decimal digits fit into a single component (see capacity)
+    this->pimpl()->data_.reserve((digits + impl::C_DECIMAL_WIDTH - 1) / impl::C_DECIMAL_WIDTH);
+}
+
+size_t aint::capacity() const {
+    return(this->pimpl()->data_.capacity() * impl::C_DECIMAL_WIDTH);
+}
+
+void aint::shrink_to_fit() {
+    this->pimpl()->data_.shrink_to_fit();
+}
+
+void aint::setTimesAlgorithm(timesAlgorithm algo) {
+    aint::impl::timesAlgorithm_ = algo;
+}
+
+aint::timesAlgorithm aint::getTimesAlgorithm() {
+    return(aint::impl::timesAlgorithm_);
+}
+
+void aint::setThreads(unsigned int threads) {
+    aint::impl::setThreads(threads);
+}
+
+unsigned int aint::getThreads() {
+    return(aint::impl::threads_);
+}
+
+void aint::setMemoryFunctions(allocateFunction allocate, reallocateFunction reallocate, freeFunction free) {
+    memory::allocate_   = (allocate   != NULL ? allocate   : &memory::defaultAllocate);
+    memory::reallocate_ = (reallocate != NULL ? reallocate : &memory::defaultReallocate);
+    memory::free_       = (free       != NULL ? free       : &memory::defaultFree);
 }
 
+void aint::getMemoryFunctions(allocateFunction* allocate, reallocateFunction* reallocate, freeFunction* free) {
+    if (allocate != NULL) {
+        *allocate = memory::allocate_;
+    }
+    if (reallocate != NULL) {
+        *reallocate = memory::reallocate_;
+    }
+    if (free != NULL) {
+        *free = memory::free_;
+    }
+}
+
+#if defined(AINT_TUNE)
+void aint::tune(std::ostream& out) {
+    aint::impl::tune(out);
+}
+#endif
+
 
 } // end of namespace astd
@@ -0,0 +1,78 @@
+/*
+ *  This file is part of aint.
+ *
+ *  aint provides a C++ class for arbitrary long integers which can be
+ *  used the same way as the C/C++ integer types (e.g. int or long),
+ *  but has no restriction on the length (if there is enough memory).
+ *  Aim of this project is to include fast integer multiplications
+ *  like the Toom-Cook algorithm or the Schoenhage-Strassen algorithm.
+ *  Copyright (C) 2014 Mario Baumann (mario-baumann@web.de)
+ *
+ *  aint is free software: you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  aint is distributed in the hope that it will be useful, but
+ *  WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with aint.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************/
+
+// arbitrary long integer
+// aint_montgomery.cxx (multiplication modulo a fixed modulus)
+
+#include "impl.hxx"
+
+namespace astd {
+
+aint::montgomery::montgomery(const aint& m) : modulus_(m) {
+    if (m == 0) {
+        throw std::overflow_error("Divide by zero");
+    }
+    this->modulus_.pimpl()->positive_ = true;
+    if (!impl::montgomeryInverse(this->modulus_, this->inverse_)) {
+        throw std::invalid_argument("modulus not coprime to the radix in: " + std::string(__FUNCTION__));
+    }
+    // square_ = B^2n % modulus_, where modulus_ has n single components
+    impl::shiftComps(aint(1), 2 * static_cast<long>(this->modulus_.pimpl()->data_.size()), this->square_);
+    this->square_ %= this->modulus_;
+}
+
+const aint& aint::montgomery::modulus() const {
+    return(this->modulus_);
+}
+
+aint aint::montgomery::to(const aint& a) const {
+    // a * B^n % m = (a % m) * (B^2n % m) / B^n % m
+    aint res = a % this->modulus_;
+    if (!res.pimpl()->positive_) {
+        res += this->modulus_;
+    }
+    impl::montgomeryTimes(res, this->square_, this->modulus_, this->inverse_, res);
+    return(res);
+}
+
+aint aint::montgomery::from(const aint& x) const {
+    aint res;
+    impl::montgomeryTimes(x, aint(1), this->modulus_, this->inverse_, res);
+    return(res);
+}
+
+aint aint::montgomery::times(const aint& x, const aint& y) const {
+    aint res;
+    impl::montgomeryTimes(x, y, this->modulus_, this->inverse_, res);
+    return(res);
+}
+
+aint aint::montgomery::square(const aint& x) const {
+    aint res;
+    impl::montgomeryTimes(x, x, this->modulus_, this->inverse_, res);
+    return(res);
+}
+
+} // end of namespace astd
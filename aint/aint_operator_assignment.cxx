@@ -32,46 +32,51 @@ namespace astd {
 
 aint& aint::operator=(const aint& rhs) {
     if (this != &rhs) {
-        *impl_ = *rhs.impl_;
+        if (!impl_ || rhs.pimpl()->data_.size() > impl_->data_.capacity()) {
+            // allocate a new block instead of the single components only (or the
+            // first one of a moved-from aint)
+            impl_.reset(impl::create(*rhs.pimpl()));
+        } else {
+            *impl_ = *rhs.pimpl();
+        }
     }
     return(*this);
 }
-aint& aint::operator=(aint&& rhs) {
-    if (this != &rhs) {
-        *impl_ = std::move(*rhs.impl_);
-    }
+aint& aint::operator=(aint&& rhs) noexcept {
+    // take over the impl of rhs, which gets the old value (no single components are copied)
+    impl_.swap(rhs.impl_);
     return(*this);
 }
 aint& aint::operator=(const char* s) {
-    this->impl_->ctorC(s);
+    this->pimpl()->ctorC(s);
     return(*this);
 }
 aint& aint::operator=(const std::string& s) {
-    this->impl_->ctorC(s.c_str());
+    this->pimpl()->ctorC(s.c_str());
     return(*this);
 }
 aint& aint::operator=(const int i) {
-    this->impl_->ctorLL(i);
+    this->pimpl()->ctorLL(i);
     return(*this);
 }
 aint& aint::operator=(const long int i) {
-    this->impl_->ctorLL(i);
+    this->pimpl()->ctorLL(i);
     return(*this);
 }
 aint& aint::operator=(const long long int i) {
-    this->impl_->ctorLL(i);
+    this->pimpl()->ctorLL(i);
     return(*this);
 }
 aint& aint::operator=(const unsigned int i) {
-    this->impl_->ctorULL(i);
+    this->pimpl()->ctorULL(i);
     return(*this);
 }
 aint& aint::operator=(const unsigned long int i) {
-    this->impl_->ctorULL(i);
+    this->pimpl()->ctorULL(i);
     return(*this);
 }
 aint& aint::operator=(const unsigned long long int i) {
-    this->impl_->ctorULL(i);
+    this->pimpl()->ctorULL(i);
     return(*this);
 }
 
@@ -31,68 +31,39 @@
 namespace astd {
 
 aint& aint::operator/=(const aint& rhs) {
-    if (this != &rhs) {
-        aint quot;
-        aint rem;
-        this->impl_->operatorDivide(*this, rhs, quot, rem);
-        *this = quot;
-    }
+    this->pimpl()->operatorDivide(*this, rhs, this, NULL);
     return(*this);
 }
 aint& aint::operator/=(const char* s) {
-    aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(s), quot, rem);
-    *this = quot;
+    this->pimpl()->operatorDivide(*this, aint(s), this, NULL);
     return(*this);
 }
 aint& aint::operator/=(const std::string& s) {
-    aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(s), quot, rem);
-    *this = quot;
+    this->pimpl()->operatorDivide(*this, aint(s), this, NULL);
     return(*this);
 }
 aint& aint::operator/=(const int i) {
-    aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(i), quot, rem);
-    *this = quot;
+    this->pimpl()->operatorDivideULL(*this, impl::absLL(i), i >= 0, *this);
     return(*this);
 }
 aint& aint::operator/=(const long int i) {
-    aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(i), quot, rem);
-    *this = quot;
+    this->pimpl()->operatorDivideULL(*this, impl::absLL(i), i >= 0, *this);
     return(*this);
 }
 aint& aint::operator/=(const long long int i) {
-    aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(i), quot, rem);
-    *this = quot;
+    this->pimpl()->operatorDivideULL(*this, impl::absLL(i), i >= 0, *this);
     return(*this);
 }
 aint& aint::operator/=(const unsigned int i) {
-    aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(i), quot, rem);
-    *this = quot;
+    this->pimpl()->operatorDivideULL(*this, i, true, *this);
     return(*this);
 }
 aint& aint::operator/=(const unsigned long int i) {
-    aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(i), quot, rem);
-    *this = quot;
+    this->pimpl()->operatorDivideULL(*this, i, true, *this);
     return(*this);
 }
 aint& aint::operator/=(const unsigned long long int i) {
-    aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(i), quot, rem);
-    *this = quot;
+    this->pimpl()->operatorDivideULL(*this, i, true, *this);
     return(*this);
 }
 
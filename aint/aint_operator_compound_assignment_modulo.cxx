@@ -31,68 +31,43 @@
 namespace astd {
 
 aint& aint::operator%=(const aint& rhs) {
-    if (this != &rhs) {
-        aint quot;
-        aint rem;
-        this->impl_->operatorDivide(*this, rhs, quot, rem);
-        *this = rem;
-    }
+    this->pimpl()->operatorDivide(*this, rhs, NULL, this);
     return(*this);
 }
 aint& aint::operator%=(const char* s) {
-    aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(s), quot, rem);
-    *this = rem;
+    this->pimpl()->operatorDivide(*this, aint(s), NULL, this);
     return(*this);
 }
 aint& aint::operator%=(const std::string& s) {
-    aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(s), quot, rem);
-    *this = rem;
+    this->pimpl()->operatorDivide(*this, aint(s), NULL, this);
     return(*this);
 }
 aint& aint::operator%=(const int i) {
-    aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(i), quot, rem);
-    *this = rem;
+    this->pimpl()->operatorModuloULL(*this, impl::absLL(i), *this);
     return(*this);
 }
 aint& aint::operator%=(const long int i) {
-    aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(i), quot, rem);
-    *this = rem;
+    this->pimpl()->operatorModuloULL(*this, impl::absLL(i), *this);
     return(*this);
 }
 aint& aint::operator%=(const long long int i) {
-    aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(i), quot, rem);
-    *this = rem;
+    this->pimpl()->operatorModuloULL(*this, impl::absLL(i), *this);
     return(*this);
 }
 aint& aint::operator%=(const unsigned int i) {
-    aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(i), quot, rem);
-    *this = rem;
+    this->pimpl()->operatorModuloULL(*this, i, *this);
     return(*this);
 }
 aint& aint::operator%=(const unsigned long int i) {
-    aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(i), quot, rem);
-    *this = rem;
+    this->pimpl()->operatorModuloULL(*this, i, *this);
     return(*this);
 }
 aint& aint::operator%=(const unsigned long long int i) {
-    aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(i), quot, rem);
-    *this = rem;
+    this->pimpl()->operatorModuloULL(*this, i, *this);
+    return(*this);
+}
+aint& aint::operator%=(const barrett& rhs) {
+    this->pimpl()->operatorModuloBarrett(*this, rhs.modulus_, rhs.reciprocal_, *this);
     return(*this);
 }
 
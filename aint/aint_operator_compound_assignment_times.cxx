@@ -31,59 +31,39 @@
 namespace astd {
 
 aint& aint::operator*=(const aint& rhs) {
-    if (this != &rhs) {
-        aint res;
-        this->impl_->operatorTimes(*this, rhs, res);
-        *this = res;
-    }
+    this->pimpl()->operatorTimes(*this, rhs, *this);
     return(*this);
 }
 aint& aint::operator*=(const char* s) {
-    aint res;
-    this->impl_->operatorTimes(*this, aint(s), res);
-    *this = res;
+    this->pimpl()->operatorTimes(*this, aint(s), *this);
     return(*this);
 }
 aint& aint::operator*=(const std::string& s) {
-    aint res;
-    this->impl_->operatorTimes(*this, aint(s), res);
-    *this = res;
+    this->pimpl()->operatorTimes(*this, aint(s), *this);
     return(*this);
 }
 aint& aint::operator*=(const int i) {
-    aint res;
-    this->impl_->operatorTimes(*this, aint(i), res);
-    *this = res;
+    this->pimpl()->operatorTimesULL(*this, impl::absLL(i), i >= 0, *this);
     return(*this);
 }
 aint& aint::operator*=(const long int i) {
-    aint res;
-    this->impl_->operatorTimes(*this, aint(i), res);
-    *this = res;
+    this->pimpl()->operatorTimesULL(*this, impl::absLL(i), i >= 0, *this);
     return(*this);
 }
 aint& aint::operator*=(const long long int i) {
-    aint res;
-    this->impl_->operatorTimes(*this, aint(i), res);
-    *this = res;
+    this->pimpl()->operatorTimesULL(*this, impl::absLL(i), i >= 0, *this);
     return(*this);
 }
 aint& aint::operator*=(const unsigned int i) {
-    aint res;
-    this->impl_->operatorTimes(*this, aint(i), res);
-    *this = res;
+    this->pimpl()->operatorTimesULL(*this, i, true, *this);
     return(*this);
 }
 aint& aint::operator*=(const unsigned long int i) {
-    aint res;
-    this->impl_->operatorTimes(*this, aint(i), res);
-    *this = res;
+    this->pimpl()->operatorTimesULL(*this, i, true, *this);
     return(*this);
 }
 aint& aint::operator*=(const unsigned long long int i) {
-    aint res;
-    this->impl_->operatorTimes(*this, aint(i), res);
-    *this = res;
+    this->pimpl()->operatorTimesULL(*this, i, true, *this);
     return(*this);
 }
 
@@ -30,88 +30,81 @@
 
 namespace astd {
 
-const aint aint::operator/(const aint& rhs) const {
+aint aint::operator/(const aint& rhs) const {
     aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, rhs, quot, rem);
+    this->pimpl()->operatorDivide(*this, rhs, &quot, NULL);
     return(quot);
 }
-const aint aint::operator/(const int rhs) const {
+aint aint::operator/(const int rhs) const {
     aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(rhs), quot, rem);
+    this->pimpl()->operatorDivideULL(*this, impl::absLL(rhs), rhs >= 0, quot);
     return(quot);
 }
-const aint aint::operator/(const long int rhs) const {
+aint aint::operator/(const long int rhs) const {
     aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(rhs), quot, rem);
+    this->pimpl()->operatorDivideULL(*this, impl::absLL(rhs), rhs >= 0, quot);
     return(quot);
 }
-const aint aint::operator/(const long long int rhs) const {
+aint aint::operator/(const long long int rhs) const {
     aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(rhs), quot, rem);
+    this->pimpl()->operatorDivideULL(*this, impl::absLL(rhs), rhs >= 0, quot);
     return(quot);
 }
-const aint aint::operator/(const unsigned int rhs) const {
+aint aint::operator/(const unsigned int rhs) const {
     aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(rhs), quot, rem);
+    this->pimpl()->operatorDivideULL(*this, rhs, true, quot);
     return(quot);
 }
-const aint aint::operator/(const unsigned long int rhs) const {
+aint aint::operator/(const unsigned long int rhs) const {
     aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(rhs), quot, rem);
+    this->pimpl()->operatorDivideULL(*this, rhs, true, quot);
     return(quot);
 }
-const aint aint::operator/(const unsigned long long int rhs) const {
+aint aint::operator/(const unsigned long long int rhs) const {
     aint quot;
-    aint rem;
-    this->impl_->operatorDivide(*this, aint(rhs), quot, rem);
+    this->pimpl()->operatorDivideULL(*this, rhs, true, quot);
     return(quot);
 }
-const aint operator/(const int lhs, const aint& rhs) {
+aint operator/(const int lhs, const aint& rhs) {
     aint quot;
     aint rem;
-    rhs.impl_->operatorDivide(aint(lhs), rhs, quot, rem);
+    rhs.pimpl()->operatorDivideULL(aint::impl::absLL(lhs), lhs >= 0, rhs, quot, rem);
     return(quot);
 }
-const aint operator/(const long int lhs, const aint& rhs) {
+aint operator/(const long int lhs, const aint& rhs) {
     aint quot;
     aint rem;
-    rhs.impl_->operatorDivide(aint(lhs), rhs, quot, rem);
+    rhs.pimpl()->operatorDivideULL(aint::impl::absLL(lhs), lhs >= 0, rhs, quot, rem);
     return(quot);
 }
-const aint operator/(const long long int lhs, const aint& rhs) {
+aint operator/(const long long int lhs, const aint& rhs) {
     aint quot;
     aint rem;
-    rhs.impl_->operatorDivide(aint(lhs), rhs, quot, rem);
+    rhs.pimpl()->operatorDivideULL(aint::impl::absLL(lhs), lhs >= 0, rhs, quot, rem);
     return(quot);
 }
-const aint operator/(const unsigned int lhs, const aint& rhs) {
+aint operator/(const unsigned int lhs, const aint& rhs) {
     aint quot;
     aint rem;
-    rhs.impl_->operatorDivide(aint(lhs), rhs, quot, rem);
+    rhs.pimpl()->operatorDivideULL(lhs, true, rhs, quot, rem);
     return(quot);
 }
-const aint operator/(const unsigned long int lhs, const aint& rhs) {
+aint operator/(const unsigned long int lhs, const aint& rhs) {
     aint quot;
     aint rem;
-    rhs.impl_->operatorDivide(aint(lhs), rhs, quot, rem);
+    rhs.pimpl()->operatorDivideULL(lhs, true, rhs, quot, rem);
     return(quot);
 }
-const aint operator/(const unsigned long long int lhs, const aint& rhs) {
+aint operator/(const unsigned long long int lhs, const aint& rhs) {
     aint quot;
     aint rem;
-    rhs.impl_->operatorDivide(aint(lhs), rhs, quot, rem);
+    rhs.pimpl()->operatorDivideULL(lhs, true, rhs, quot, rem);
     return(quot);
 }
 
-const aint::adiv aint::div(const aint& rhs) const {
+aint::adiv aint::div(const aint& rhs) const {
     std::pair<aint,aint> res;
-    this->impl_->operatorDivide(*this, rhs, res.first, res.second);
+    this->pimpl()->operatorDivide(*this, rhs, res.first, res.second);
     return(res);
 }
 
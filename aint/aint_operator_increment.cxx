@@ -31,28 +31,28 @@
 namespace astd {
 
 aint& aint::operator++() {
-    if (this->impl_->positive_) {
+    if (this->pimpl()->positive_) {
         // aint is positvie
-        if (this->impl_->data_[0] == this->impl_->C_SINGLE_COMP_MAX_P1 - 1) {
+        if (this->pimpl()->data_[0] == this->pimpl()->C_SINGLE_COMP_MAX_P1 - 1) {
             // handle overflow in last data segment
-            this->impl_->operatorPlus(aint(*this), aint(1), *this);
+            this->pimpl()->operatorPlusULL(*this, 1, true, *this);
         } else {
-            this->impl_->data_[0] += 1;
+            this->pimpl()->data_[0] += 1;
         }
     } else {
         // aint is negative
-        if (this->impl_->data_[0] == 0) {
+        if (this->pimpl()->data_[0] == 0) {
             // handle underflow in last data segment
-            this->impl_->operatorPlus(aint(*this), aint(1), *this, true);
+            this->pimpl()->operatorPlusULL(*this, 1, true, *this);
         } else {
-            this->impl_->data_[0] -= 1;
-            this->impl_->makeZeroPositive();
+            this->pimpl()->data_[0] -= 1;
+            this->pimpl()->makeZeroPositive();
         }
     }
     return(*this);
 }
 
-const aint aint::operator++(int) {
+aint aint::operator++(int) {
     aint res(*this); // store current state
     ++(*this);       // apply above operator
     return(res);     // return saved state
@@ -30,76 +30,117 @@
 
 namespace astd {
 
-const aint aint::operator-() {
-    if (this->impl_->data_.size() != 1 || this->impl_->data_[0] != 0) {
-        this->impl_->positive_ = !(this->impl_->positive_);
+aint aint::operator-() const& {
+    aint res(*this);
+    return(-std::move(res));
+}
+aint aint::operator-() && {
+    if (this->pimpl()->data_.size() != 1 || this->pimpl()->data_[0] != 0) {
+        this->pimpl()->positive_ = !(this->pimpl()->positive_);
     }
-    return(*this);
+    return(std::move(*this));
 }
-const aint aint::operator-(const aint& rhs) const {
+aint aint::operator-(const aint& rhs) const& {
     aint res;
-    this->impl_->operatorPlus(*this, rhs, res, true);
+    this->pimpl()->operatorPlus(*this, rhs, res, true);
     return(res);
 }
-const aint aint::operator-(const int rhs) const {
+aint aint::operator-(const aint& rhs) && {
+    // the expiring lhs takes the result (operatorPlus allows res to be an operand)
+    this->pimpl()->operatorPlus(*this, rhs, *this, true);
+    return(std::move(*this));
+}
+aint aint::operator-(aint&& rhs) const& {
+    rhs.pimpl()->operatorPlus(*this, rhs, rhs, true);
+    return(std::move(rhs));
+}
+aint aint::operator-(aint&& rhs) && {
+    this->pimpl()->operatorPlus(*this, rhs, *this, true);
+    return(std::move(*this));
+}
+aint aint::operator-(const int rhs) const& {
     aint res;
-    this->impl_->operatorPlus(*this, aint(rhs), res, true);
+    this->pimpl()->operatorPlusULL(*this, impl::absLL(rhs), rhs < 0, res);
     return(res);
 }
-const aint aint::operator-(const long int rhs) const {
+aint aint::operator-(const int rhs) && {
+    this->pimpl()->operatorPlusULL(*this, impl::absLL(rhs), rhs < 0, *this);
+    return(std::move(*this));
+}
+aint aint::operator-(const long int rhs) const& {
     aint res;
-    this->impl_->operatorPlus(*this, aint(rhs), res, true);
+    this->pimpl()->operatorPlusULL(*this, impl::absLL(rhs), rhs < 0, res);
     return(res);
 }
-const aint aint::operator-(const long long int rhs) const {
+aint aint::operator-(const long int rhs) && {
+    this->pimpl()->operatorPlusULL(*this, impl::absLL(rhs), rhs < 0, *this);
+    return(std::move(*this));
+}
+aint aint::operator-(const long long int rhs) const& {
     aint res;
-    this->impl_->operatorPlus(*this, aint(rhs), res, true);
+    this->pimpl()->operatorPlusULL(*this, impl::absLL(rhs), rhs < 0, res);
     return(res);
 }
-const aint aint::operator-(const unsigned int rhs) const {
+aint aint::operator-(const long long int rhs) && {
+    this->pimpl()->operatorPlusULL(*this, impl::absLL(rhs), rhs < 0, *this);
+    return(std::move(*this));
+}
+aint aint::operator-(const unsigned int rhs) const& {
     aint res;
-    this->impl_->operatorPlus(*this, aint(rhs), res, true);
+    this->pimpl()->operatorPlusULL(*this, rhs, false, res);
     return(res);
 }
-const aint aint::operator-(const unsigned long int rhs) const {
+aint aint::operator-(const unsigned int rhs) && {
+    this->pimpl()->operatorPlusULL(*this, rhs, false, *this);
+    return(std::move(*this));
+}
+aint aint::operator-(const unsigned long int rhs) const& {
     aint res;
-    this->impl_->operatorPlus(*this, aint(rhs), res, true);
+    this->pimpl()->operatorPlusULL(*this, rhs, false, res);
     return(res);
 }
-const aint aint::operator-(const unsigned long long int rhs) const {
+aint aint::operator-(const unsigned long int rhs) && {
+    this->pimpl()->operatorPlusULL(*this, rhs, false, *this);
+    return(std::move(*this));
+}
+aint aint::operator-(const unsigned long long int rhs) const& {
     aint res;
-    this->impl_->operatorPlus(*this, aint(rhs), res, true);
+    this->pimpl()->operatorPlusULL(*this, rhs, false, res);
     return(res);
 }
-const aint operator-(const int lhs, const aint& rhs) {
+aint aint::operator-(const unsigned long long int rhs) && {
+    this->pimpl()->operatorPlusULL(*this, rhs, false, *this);
+    return(std::move(*this));
+}
+aint operator-(const int lhs, const aint& rhs) {
     aint res;
-    rhs.impl_->operatorPlus(aint(lhs), rhs, res, true);
-    return(res);
+    rhs.pimpl()->operatorPlusULL(rhs, aint::impl::absLL(lhs), lhs < 0, res);
+    return(-std::move(res));
 }
-const aint operator-(const long int lhs, const aint& rhs) {
+aint operator-(const long int lhs, const aint& rhs) {
     aint res;
-    rhs.impl_->operatorPlus(aint(lhs), rhs, res, true);
-    return(res);
+    rhs.pimpl()->operatorPlusULL(rhs, aint::impl::absLL(lhs), lhs < 0, res);
+    return(-std::move(res));
 }
-const aint operator-(const long long int lhs, const aint& rhs) {
+aint operator-(const long long int lhs, const aint& rhs) {
     aint res;
-    rhs.impl_->operatorPlus(aint(lhs), rhs, res, true);
-    return(res);
+    rhs.pimpl()->operatorPlusULL(rhs, aint::impl::absLL(lhs), lhs < 0, res);
+    return(-std::move(res));
 }
-const aint operator-(const unsigned int lhs, const aint& rhs) {
+aint operator-(const unsigned int lhs, const aint& rhs) {
     aint res;
-    rhs.impl_->operatorPlus(aint(lhs), rhs, res, true);
-    return(res);
+    rhs.pimpl()->operatorPlusULL(rhs, lhs, false, res);
+    return(-std::move(res));
 }
-const aint operator-(const unsigned long int lhs, const aint& rhs) {
+aint operator-(const unsigned long int lhs, const aint& rhs) {
     aint res;
-    rhs.impl_->operatorPlus(aint(lhs), rhs, res, true);
-    return(res);
+    rhs.pimpl()->operatorPlusULL(rhs, lhs, false, res);
+    return(-std::move(res));
 }
-const aint operator-(const unsigned long long int lhs, const aint& rhs) {
+aint operator-(const unsigned long long int lhs, const aint& rhs) {
     aint res;
-    rhs.impl_->operatorPlus(aint(lhs), rhs, res, true);
-    return(res);
+    rhs.pimpl()->operatorPlusULL(rhs, lhs, false, res);
+    return(-std::move(res));
 }
 
 } // end of namespace astd
@@ -30,82 +30,80 @@
 
 namespace astd {
 
-const aint aint::operator%(const aint& rhs) const {
-    aint quot;
+aint aint::operator%(const aint& rhs) const {
     aint rem;
-    this->impl_->operatorDivide(*this, rhs, quot, rem);
+    this->pimpl()->operatorDivide(*this, rhs, NULL, &rem);
     return(rem);
 }
-const aint aint::operator%(const int rhs) const {
-    aint quot;
+aint aint::operator%(const int rhs) const {
     aint rem;
-    this->impl_->operatorDivide(*this, aint(rhs), quot, rem);
+    this->pimpl()->operatorModuloULL(*this, impl::absLL(rhs), rem);
     return(rem);
 }
-const aint aint::operator%(const long int rhs) const {
-    aint quot;
+aint aint::operator%(const long int rhs) const {
     aint rem;
-    this->impl_->operatorDivide(*this, aint(rhs), quot, rem);
+    this->pimpl()->operatorModuloULL(*this, impl::absLL(rhs), rem);
     return(rem);
 }
-const aint aint::operator%(const long long int rhs) const {
-    aint quot;
+aint aint::operator%(const long long int rhs) const {
     aint rem;
-    this->impl_->operatorDivide(*this, aint(rhs), quot, rem);
+    this->pimpl()->operatorModuloULL(*this, impl::absLL(rhs), rem);
     return(rem);
 }
-const aint aint::operator%(const unsigned int rhs) const {
-    aint quot;
+aint aint::operator%(const unsigned int rhs) const {
     aint rem;
-    this->impl_->operatorDivide(*this, aint(rhs), quot, rem);
+    this->pimpl()->operatorModuloULL(*this, rhs, rem);
     return(rem);
 }
-const aint aint::operator%(const unsigned long int rhs) const {
-    aint quot;
+aint aint::operator%(const unsigned long int rhs) const {
     aint rem;
-    this->impl_->operatorDivide(*this, aint(rhs), quot, rem);
+    this->pimpl()->operatorModuloULL(*this, rhs, rem);
     return(rem);
 }
-const aint aint::operator%(const unsigned long long int rhs) const {
-    aint quot;
+aint aint::operator%(const unsigned long long int rhs) const {
+    aint rem;
+    this->pimpl()->operatorModuloULL(*this, rhs, rem);
+    return(rem);
+}
+aint aint::operator%(const barrett& rhs) const {
     aint rem;
-    this->impl_->operatorDivide(*this, aint(rhs), quot, rem);
+    this->pimpl()->operatorModuloBarrett(*this, rhs.modulus_, rhs.reciprocal_, rem);
     return(rem);
 }
-const aint operator%(const int lhs, const aint& rhs) {
+aint operator%(const int lhs, const aint& rhs) {
     aint quot;
     aint rem;
-    rhs.impl_->operatorDivide(aint(lhs), rhs, quot, rem);
+    rhs.pimpl()->operatorDivideULL(aint::impl::absLL(lhs), lhs >= 0, rhs, quot, rem);
     return(rem);
 }
-const aint operator%(const long int lhs, const aint& rhs) {
+aint operator%(const long int lhs, const aint& rhs) {
     aint quot;
     aint rem;
-    rhs.impl_->operatorDivide(aint(lhs), rhs, quot, rem);
+    rhs.pimpl()->operatorDivideULL(aint::impl::absLL(lhs), lhs >= 0, rhs, quot, rem);
     return(rem);
 }
-const aint operator%(const long long int lhs, const aint& rhs) {
+aint operator%(const long long int lhs, const aint& rhs) {
     aint quot;
     aint rem;
-    rhs.impl_->operatorDivide(aint(lhs), rhs, quot, rem);
+    rhs.pimpl()->operatorDivideULL(aint::impl::absLL(lhs), lhs >= 0, rhs, quot, rem);
     return(rem);
 }
-const aint operator%(const unsigned int lhs, const aint& rhs) {
+aint operator%(const unsigned int lhs, const aint& rhs) {
     aint quot;
     aint rem;
-    rhs.impl_->operatorDivide(aint(lhs), rhs, quot, rem);
+    rhs.pimpl()->operatorDivideULL(lhs, true, rhs, quot, rem);
     return(rem);
 }
-const aint operator%(const unsigned long int lhs, const aint& rhs) {
+aint operator%(const unsigned long int lhs, const aint& rhs) {
     aint quot;
     aint rem;
-    rhs.impl_->operatorDivide(aint(lhs), rhs, quot, rem);
+    rhs.pimpl()->operatorDivideULL(lhs, true, rhs, quot, rem);
     return(rem);
 }
-const aint operator%(const unsigned long long int lhs, const aint& rhs) {
+aint operator%(const unsigned long long int lhs, const aint& rhs) {
     aint quot;
     aint rem;
-    rhs.impl_->operatorDivide(aint(lhs), rhs, quot, rem);
+    rhs.pimpl()->operatorDivideULL(lhs, true, rhs, quot, rem);
     return(rem);
 }
 
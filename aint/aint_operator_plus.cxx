@@ -30,72 +30,109 @@
 
 namespace astd {
 
-const aint aint::operator+() {
+aint aint::operator+() const {
     return(*this);
 }
-const aint aint::operator+(const aint& rhs) const {
+aint aint::operator+(const aint& rhs) const& {
     aint res;
-    this->impl_->operatorPlus(*this, rhs, res);
+    this->pimpl()->operatorPlus(*this, rhs, res);
     return(res);
 }
-const aint aint::operator+(const int rhs) const {
+aint aint::operator+(const aint& rhs) && {
+    // the expiring lhs takes the result (operatorPlus allows res to be an operand)
+    this->pimpl()->operatorPlus(*this, rhs, *this);
+    return(std::move(*this));
+}
+aint aint::operator+(aint&& rhs) const& {
+    rhs.pimpl()->operatorPlus(*this, rhs, rhs);
+    return(std::move(rhs));
+}
+aint aint::operator+(aint&& rhs) && {
+    this->pimpl()->operatorPlus(*this, rhs, *this);
+    return(std::move(*this));
+}
+aint aint::operator+(const int rhs) const& {
     aint res;
-    this->impl_->operatorPlus(*this, aint(rhs), res);
+    this->pimpl()->operatorPlusULL(*this, impl::absLL(rhs), rhs >= 0, res);
     return(res);
 }
-const aint aint::operator+(const long int rhs) const {
+aint aint::operator+(const int rhs) && {
+    this->pimpl()->operatorPlusULL(*this, impl::absLL(rhs), rhs >= 0, *this);
+    return(std::move(*this));
+}
+aint aint::operator+(const long int rhs) const& {
     aint res;
-    this->impl_->operatorPlus(*this, aint(rhs), res);
+    this->pimpl()->operatorPlusULL(*this, impl::absLL(rhs), rhs >= 0, res);
     return(res);
 }
-const aint aint::operator+(const long long int rhs) const {
+aint aint::operator+(const long int rhs) && {
+    this->pimpl()->operatorPlusULL(*this, impl::absLL(rhs), rhs >= 0, *this);
+    return(std::move(*this));
+}
+aint aint::operator+(const long long int rhs) const& {
     aint res;
-    this->impl_->operatorPlus(*this, aint(rhs), res);
+    this->pimpl()->operatorPlusULL(*this, impl::absLL(rhs), rhs >= 0, res);
     return(res);
 }
-const aint aint::operator+(const unsigned int rhs) const {
+aint aint::operator+(const long long int rhs) && {
+    this->pimpl()->operatorPlusULL(*this, impl::absLL(rhs), rhs >= 0, *this);
+    return(std::move(*this));
+}
+aint aint::operator+(const unsigned int rhs) const& {
     aint res;
-    this->impl_->operatorPlus(*this, aint(rhs), res);
+    this->pimpl()->operatorPlusULL(*this, rhs, true, res);
     return(res);
 }
-const aint aint::operator+(const unsigned long int rhs) const {
+aint aint::operator+(const unsigned int rhs) && {
+    this->pimpl()->operatorPlusULL(*this, rhs, true, *this);
+    return(std::move(*this));
+}
+aint aint::operator+(const unsigned long int rhs) const& {
     aint res;
-    this->impl_->operatorPlus(*this, aint(rhs), res);
+    this->pimpl()->operatorPlusULL(*this, rhs, true, res);
     return(res);
 }
-const aint aint::operator+(const unsigned long long int rhs) const {
+aint aint::operator+(const unsigned long int rhs) && {
+    this->pimpl()->operatorPlusULL(*this, rhs, true, *this);
+    return(std::move(*this));
+}
+aint aint::operator+(const unsigned long long int rhs) const& {
     aint res;
-    this->impl_->operatorPlus(*this, aint(rhs), res);
+    this->pimpl()->operatorPlusULL(*this, rhs, true, res);
     return(res);
 }
-const aint operator+(const int lhs, const aint& rhs) {
+aint aint::operator+(const unsigned long long int rhs) && {
+    this->pimpl()->operatorPlusULL(*this, rhs, true, *this);
+    return(std::move(*this));
+}
+aint operator+(const int lhs, const aint& rhs) {
     aint res;
-    rhs.impl_->operatorPlus(aint(lhs), rhs, res);
+    rhs.pimpl()->operatorPlusULL(rhs, aint::impl::absLL(lhs), lhs >= 0, res);
     return(res);
 }
-const aint operator+(const long int lhs, const aint& rhs) {
+aint operator+(const long int lhs, const aint& rhs) {
     aint res;
-    rhs.impl_->operatorPlus(aint(lhs), rhs, res);
+    rhs.pimpl()->operatorPlusULL(rhs, aint::impl::absLL(lhs), lhs >= 0, res);
     return(res);
 }
-const aint operator+(const long long int lhs, const aint& rhs) {
+aint operator+(const long long int lhs, const aint& rhs) {
     aint res;
-    rhs.impl_->operatorPlus(aint(lhs), rhs, res);
+    rhs.pimpl()->operatorPlusULL(rhs, aint::impl::absLL(lhs), lhs >= 0, res);
     return(res);
 }
-const aint operator+(const unsigned int lhs, const aint& rhs) {
+aint operator+(const unsigned int lhs, const aint& rhs) {
     aint res;
-    rhs.impl_->operatorPlus(aint(lhs), rhs, res);
+    rhs.pimpl()->operatorPlusULL(rhs, lhs, true, res);
     return(res);
 }
-const aint operator+(const unsigned long int lhs, const aint& rhs) {
+aint operator+(const unsigned long int lhs, const aint& rhs) {
     aint res;
-    rhs.impl_->operatorPlus(aint(lhs), rhs, res);
+    rhs.pimpl()->operatorPlusULL(rhs, lhs, true, res);
     return(res);
 }
-const aint operator+(const unsigned long long int lhs, const aint& rhs) {
+aint operator+(const unsigned long long int lhs, const aint& rhs) {
     aint res;
-    rhs.impl_->operatorPlus(aint(lhs), rhs, res);
+    rhs.pimpl()->operatorPlusULL(rhs, lhs, true, res);
     return(res);
 }
 
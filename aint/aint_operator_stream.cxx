@@ -35,13 +35,20 @@ namespace astd {
 
 std::ostream& operator<< (std::ostream& out, const aint& a) {
     std::stringstream ss;
-    if (!a.impl_->positive_) {
+    if (!a.pimpl()->positive_) {
         ss << '-';
     }
-    for (auto rit = a.impl_->data_.crbegin(); rit != a.impl_->data_.crend(); ++rit) {
-        ss << std::setw(rit == a.impl_->data_.rbegin() ? 0 : aint::impl::C_SINGLE_COMP_WIDTH);
+#if defined(BINARY_RADIX)
+    // convert the single components to decimal components
+    aint::impl::data d;
+    aint::impl::limbsToDecimal(a.pimpl()->data_.data(), a.pimpl()->data_.size(), d);
+#else
+    const aint::impl::data& d = a.pimpl()->data_;
+#endif
+    for (auto rit = d.crbegin(); rit != d.crend(); ++rit) {
+        ss << std::setw(rit == d.crbegin() ? 0 : aint::impl::C_DECIMAL_WIDTH);
         ss << std::setfill('0') ;
-        ss << (int) *rit;
+        ss << (long long int) *rit;
     }
 #if defined(DUMP)
     ss << "\n" << a.dump();
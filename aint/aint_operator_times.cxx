@@ -31,69 +31,69 @@
 
 namespace astd {
 
-const aint aint::operator*(const aint& rhs) const {
+aint aint::operator*(const aint& rhs) const {
     aint res;
-    this->impl_->operatorTimes(*this, rhs, res);
+    this->pimpl()->operatorTimes(*this, rhs, res);
     return(res);
 }
-const aint aint::operator*(const int rhs) const {
+aint aint::operator*(const int rhs) const {
     aint res;
-    this->impl_->operatorTimes(*this, aint(rhs), res);
+    this->pimpl()->operatorTimesULL(*this, impl::absLL(rhs), rhs >= 0, res);
     return(res);
 }
-const aint aint::operator*(const long int rhs) const {
+aint aint::operator*(const long int rhs) const {
     aint res;
-    this->impl_->operatorTimes(*this, aint(rhs), res);
+    this->pimpl()->operatorTimesULL(*this, impl::absLL(rhs), rhs >= 0, res);
     return(res);
 }
-const aint aint::operator*(const long long int rhs) const {
+aint aint::operator*(const long long int rhs) const {
     aint res;
-    this->impl_->operatorTimes(*this, aint(rhs), res);
+    this->pimpl()->operatorTimesULL(*this, impl::absLL(rhs), rhs >= 0, res);
     return(res);
 }
-const aint aint::operator*(const unsigned int rhs) const {
+aint aint::operator*(const unsigned int rhs) const {
     aint res;
-    this->impl_->operatorTimes(*this, aint(rhs), res);
+    this->pimpl()->operatorTimesULL(*this, rhs, true, res);
     return(res);
 }
-const aint aint::operator*(const unsigned long int rhs) const {
+aint aint::operator*(const unsigned long int rhs) const {
     aint res;
-    this->impl_->operatorTimes(*this, aint(rhs), res);
+    this->pimpl()->operatorTimesULL(*this, rhs, true, res);
     return(res);
 }
-const aint aint::operator*(const unsigned long long int rhs) const {
+aint aint::operator*(const unsigned long long int rhs) const {
     aint res;
-    this->impl_->operatorTimes(*this, aint(rhs), res);
+    this->pimpl()->operatorTimesULL(*this, rhs, true, res);
     return(res);
 }
-const aint operator*(const int lhs, const aint& rhs) {
+aint operator*(const int lhs, const aint& rhs) {
     aint res;
-    rhs.impl_->operatorTimes(aint(lhs), rhs, res);
+    rhs.pimpl()->operatorTimesULL(rhs, aint::impl::absLL(lhs), lhs >= 0, res);
     return(res);
 }
-const aint operator*(const long int lhs, const aint& rhs) {
+aint operator*(const long int lhs, const aint& rhs) {
     aint res;
-    rhs.impl_->operatorTimes(aint(lhs), rhs, res);
+    rhs.pimpl()->operatorTimesULL(rhs, aint::impl::absLL(lhs), lhs >= 0, res);
     return(res);
 }
-const aint operator*(const long long int lhs, const aint& rhs) {
+aint operator*(const long long int lhs, const aint& rhs) {
     aint res;
-    rhs.impl_->operatorTimes(aint(lhs), rhs, res);
+    rhs.pimpl()->operatorTimesULL(rhs, aint::impl::absLL(lhs), lhs >= 0, res);
     return(res);
 }
-const aint operator*(const unsigned int lhs, const aint& rhs) {
+aint operator*(const unsigned int lhs, const aint& rhs) {
     aint res;
-    rhs.impl_->operatorTimes(aint(lhs), rhs, res);
+    rhs.pimpl()->operatorTimesULL(rhs, lhs, true, res);
     return(res);
 }
-const aint operator*(const unsigned long int lhs, const aint& rhs) {
+aint operator*(const unsigned long int lhs, const aint& rhs) {
     aint res;
-    rhs.impl_->operatorTimes(aint(lhs), rhs, res);
+    rhs.pimpl()->operatorTimesULL(rhs, lhs, true, res);
     return(res);
 }
-const aint operator*(const unsigned long long int lhs, const aint& rhs) {
+aint operator*(const unsigned long long int lhs, const aint& rhs) {
     aint res;
-    rhs.impl_->operatorTimes(aint(lhs), rhs, res);
+    rhs.pimpl()->operatorTimesULL(rhs, lhs, true, res);
     return(res);
 }
 
@@ -25,6 +25,12 @@
 
 // aint unit tests
 #include "cppunit.hxx"
+#include <type_traits> // std::is_nothrow_move_constructible, std::is_nothrow_move_assignable
+#include <utility>     // std::move
+
+// moving an aint neither allocates nor throws
+static_assert(std::is_nothrow_move_constructible<aint>::value, "aint(aint&&) must be noexcept");
+static_assert(std::is_nothrow_move_assignable<aint>::value, "aint::operator=(aint&&) must be noexcept");
 
 void aintTest::testCtor() {
 
@@ -46,6 +52,74 @@ void aintTest::testCtor() {
     CPPUNIT_ASSERT( aint( "1000000000") == aint( 1000000000ULL) );
 
     CPPUNIT_ASSERT( aint("0") == aint(std::string("0")) );
+
+    // copies between values stored inline and on the heap
+    aint small(7), large("123456789012345678901234567890123456789012345678901234567890");
+    aint c1(small), c2(large);
+    c1 = large;
+    c2 = small;
+    CPPUNIT_ASSERT( c1 == large && c2 == small );
+    c1 = c1;
+    c1 = c2;
+    CPPUNIT_ASSERT( c1 == small );
+    for (int j = 0; j < 30; ++j) {
+        c1 = c1 * 1000000007;
+    }
+    for (int j = 0; j < 30; ++j) {
+        c1 = c1 / 1000000007;
+    }
+    CPPUNIT_ASSERT( c1 == small );
+
+    // move construction and assignment (a moved-from aint can be assigned again)
+    {
+        aint m1("123456789012345678901234567890");
+        aint m2(std::move(m1));
+        CPPUNIT_ASSERT( m2 == aint("123456789012345678901234567890") );
+        m1 = m2;
+        CPPUNIT_ASSERT( m1 == m2 );
+        aint m3(std::move(m1));
+        m1 = -42;
+        CPPUNIT_ASSERT( m1 == -42 && m3 == m2 );
+        aint m4(std::move(m3));
+        m3 = std::move(m4);
+        CPPUNIT_ASSERT( m3 == m2 );
+        m4 = "77";
+        CPPUNIT_ASSERT( m4 == 77 );
+    }
+
+    // a moved-from aint is zero and can be used like any other aint
+    {
+        aint m1("123456789012345678901234567890");
+        aint m2 = std::move(m1) + aint(1);
+        CPPUNIT_ASSERT( m2 == aint("123456789012345678901234567891") );
+        std::stringstream ss;
+        ss << m1;
+        CPPUNIT_ASSERT( m1 == 0 && ss.str() == "0" && m1.digits() == 1 );
+        aint m3(m1);
+        aint m4;
+        m4 = m1;
+        CPPUNIT_ASSERT( m3 == 0 && m4 == 0 && m1 == m3 );
+        m1 += 1;
+        CPPUNIT_ASSERT( m1 == 1 );
+        aint m5(std::move(m2));
+        m2 *= m5;
+        CPPUNIT_ASSERT( m2 == 0 && m2 + m5 == m5 );
+    }
+
+    // conversion to and from decimal digits (e.g. with a binary radix)
+    for (size_t d = 1; d <= 20000; d += (d < 300 ? 1 : 997)) {
+        std::string s(d, '0');
+        for (size_t j = 0; j < d; ++j) {
+            s[j] = '0' + (7 * j + d) % 10;
+        }
+        s[0] = '1' + d % 9;
+        std::stringstream ss;
+        ss << aint("-" + s);
+        CPPUNIT_ASSERT( ss.str() == "-" + s );
+        CPPUNIT_ASSERT( aint(s).digits() == d );
+        CPPUNIT_ASSERT( aint(std::string(d, '9')).digits() == d );
+        CPPUNIT_ASSERT( aint(std::string(d, '9')) + 1 == aint("1" + std::string(d, '0')) );
+    }
 }
 
 // eof
@@ -25,6 +25,33 @@
 
 // aint unit tests
 #include "cppunit.hxx"
+#include <utility> // std::move
+
+namespace {
+
+// memory functions which count the bytes in use and forward to the previous functions
+aint::allocateFunction   previousAllocate;
+aint::reallocateFunction previousReallocate;
+aint::freeFunction       previousFree;
+long long int bytesInUse = 0;
+long long int allocations = 0;
+
+void* countingAllocate(size_t size) {
+    bytesInUse += size;
+    ++allocations;
+    return(previousAllocate(size));
+}
+void* countingReallocate(void* p, size_t oldSize, size_t newSize) {
+    bytesInUse += static_cast<long long int>(newSize) - static_cast<long long int>(oldSize);
+    ++allocations;
+    return(previousReallocate(p, oldSize, newSize));
+}
+void countingFree(void* p, size_t size) {
+    bytesInUse -= size;
+    previousFree(p, size);
+}
+
+} // end of namespace
 
 void aintTest::testMember() {
  
@@ -51,6 +78,10 @@ void aintTest::testMember() {
     CPPUNIT_ASSERT( aint("10000000000").digits() == 11 );
     CPPUNIT_ASSERT( aint("100000000000").digits() == 12 );
     CPPUNIT_ASSERT( aint("1000000000000").digits() == 13 );
+    CPPUNIT_ASSERT( aint("999999999999999999").digits() == 18 );
+    CPPUNIT_ASSERT( aint("1000000000000000000").digits() == 19 );
+    CPPUNIT_ASSERT( aint("9223372036854775807").digits() == 19 );
+    CPPUNIT_ASSERT( aint("10000000000000000000").digits() == 20 );
     CPPUNIT_ASSERT( aint("354224848179261915075").digits() == 21 );
 
     CPPUNIT_ASSERT( aint( 0).factorial() == 1 );
@@ -68,12 +99,111 @@ void aintTest::testMember() {
     CPPUNIT_ASSERT( aint(2).power(100) == 1267650600228229401496703205376_A );
     CPPUNIT_ASSERT( aint(2).power(101) == 2535301200456458802993406410752_A );
 
+    // http://rosettacode.org/wiki/Arbitrary-precision_integers_%28included%29
+    std::stringstream ss;
+    ss << aint(5).power(aint(4).power(aint(3).power(2)));
+    CPPUNIT_ASSERT( ss.str().size() == 183231 );
+    CPPUNIT_ASSERT( ss.str().substr(0, 20) == "62060698786608744707" );
+    CPPUNIT_ASSERT( ss.str().substr(183231 - 20) == "92256259918212890625" );
+
     CPPUNIT_ASSERT( aint(2).powertower(-1) == 0 );
     CPPUNIT_ASSERT( aint(2).powertower(0) == 1 );
     CPPUNIT_ASSERT( aint(2).powertower(1) == 2 );
     CPPUNIT_ASSERT( aint(2).powertower(2) == 4 );
     CPPUNIT_ASSERT( aint(2).powertower(3) == 16 );
     CPPUNIT_ASSERT( aint(4).powertower(3) == 13407807929942597099574024998205846127479365820592393377723561443721764030073546976801874298166903427690031858186486050853753882811946569946433649006084096_A );
+
+    // power modulo a modulus coprime to the radix (Montgomery's multiplication) and
+    // a modulus with the factors 2 and 5 (Barrett's reduction)
+    CPPUNIT_ASSERT( aint(2).powmod(-1, 7) == 0 && aint(2).powmod(0, 7) == 1 && aint(2).powmod(0, -1) == 0 );
+    CPPUNIT_ASSERT( aint(3).powmod(200, 1000003) == aint(3).power(200) % 1000003 );
+    CPPUNIT_ASSERT( aint(-3).powmod(201, 1000) == aint(-3).power(201) % 1000 );
+    CPPUNIT_ASSERT( aint(-3).powmod(201, -1001) == aint(-3).power(201) % -1001 );
+    aint p = aint(2).power(521) - 1; // Mersenne prime
+    CPPUNIT_ASSERT( aint(3).powmod(p - 1, p) == 1 && aint(12345).powmod(p, p) == 12345 );
+    aint q = aint(10).power(300) + 6;
+    CPPUNIT_ASSERT( aint(7).powmod(1000, q) == aint(7).power(1000) % q );
+    CPPUNIT_ASSERT( (q + 1).powmod(777, q + 1) == 0 && aint(-7).powmod(999, q + 1) == aint(-7).power(999) % (q + 1) );
+
+    // multiplication in Montgomery form
+    aint::montgomery r(aint(3).power(700) + 2);
+    aint a = aint(7).power(1200);
+    aint b = aint(11).power(800) + 1;
+    CPPUNIT_ASSERT( r.from(r.times(r.to(a), r.to(b))) == a * b % r.modulus() );
+    CPPUNIT_ASSERT( r.from(r.square(r.to(a))) == a * a % r.modulus() && r.from(r.to(-1)) == r.modulus() - 1 );
+
+    // memory functions (the aints below use the single components only, so the
+    // scratch arena is not used and all memory is freed at the end of the scope)
+    aint::getMemoryFunctions(&previousAllocate, &previousReallocate, &previousFree);
+    aint::setMemoryFunctions(&countingAllocate, &countingReallocate, &countingFree);
+    {
+        aint a("12345678901234567890123456789");
+        aint b(a);
+        CPPUNIT_ASSERT( bytesInUse > 0 && allocations >= 2 );
+        // moving allocates nothing
+        long long int n = allocations;
+        aint c(std::move(b));
+        b = std::move(c);
+        CPPUNIT_ASSERT( allocations == n && b == a );
+        for (int j = 0; j < 3; ++j) {
+            b *= a;
+            b += a;
+        }
+        CPPUNIT_ASSERT( b == a.power(4) + a.power(3) + a.power(2) + a );
+    }
+    CPPUNIT_ASSERT( bytesInUse == 0 );
+
+    // reserve, capacity and shrink_to_fit (the compound assignments keep the capacity)
+    {
+        aint s(1);
+        aint a("123456789012345678901234567890");
+        unsigned long long int t = 1;
+        s.reserve(1000);
+        CPPUNIT_ASSERT( s.capacity() >= 1000 );
+        long long int n = allocations;
+        for (unsigned int j = 1; j <= 100; ++j) {
+            s *= 10;
+            s += j + 1;
+            s *= s;
+            s -= 3;
+            s *= a;
+            s %= 1000003;
+            t = ((t * 10 + j + 1) * (t * 10 + j + 1) - 3) % 1000003 * 671935 % 1000003; // a % 1000003 == 671935
+        }
+        CPPUNIT_ASSERT( allocations == n && s == t );
+        s.shrink_to_fit();
+        CPPUNIT_ASSERT( s.capacity() < 1000 && s == 907166 );
+        s = 0;
+        s.shrink_to_fit();
+        CPPUNIT_ASSERT( s == 0 && s.capacity() < 1000 );
+    }
+    CPPUNIT_ASSERT( bytesInUse == 0 );
+
+    // the long division in place writes quotient and remainder into the capacity of the result
+    {
+        aint a("123456789012345678901234567890");
+        aint d = a * a * a;
+        aint e = d * a + 12345;
+        aint s;
+        s.reserve(200);
+        long long int n = allocations;
+        s = e;
+        s /= a;
+        CPPUNIT_ASSERT( s == d );
+        s = e;
+        s %= a;
+        CPPUNIT_ASSERT( s == 12345 );
+        s = e;
+        s /= s;
+        CPPUNIT_ASSERT( s == 1 && allocations == n );
+    }
+    CPPUNIT_ASSERT( bytesInUse == 0 );
+    aint::setMemoryFunctions(NULL, NULL, NULL);
+    aint::allocateFunction allocate;
+    aint::reallocateFunction reallocate;
+    aint::freeFunction free;
+    aint::getMemoryFunctions(&allocate, &reallocate, &free);
+    CPPUNIT_ASSERT( allocate == previousAllocate && reallocate == previousReallocate && free == previousFree );
 }
 
 // eof
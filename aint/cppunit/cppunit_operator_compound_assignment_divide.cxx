@@ -38,6 +38,11 @@ void aintTest::testOperatorCompoundAssignmentDivide()
     *a1 = 13; CPPUNIT_ASSERT( (*a1 /= 2UL)  == 6 );
     *a1 = 13; CPPUNIT_ASSERT( (*a1 /= 2ULL) == 6 );
     *a1 = 13; CPPUNIT_ASSERT( ((*a1 /= "2") /= "3") == 2 );
+
+    // in place, also with itself as operand
+    *a1 = aint("123456789012345678901234567890"); CPPUNIT_ASSERT( (*a1 /= *a1) == 1 );
+    *a1 = aint("15241578753238836750495351562536198787501905199875019052100"); CPPUNIT_ASSERT( (*a1 /= aint("-123456789012345678901234567890")) == aint("-123456789012345678901234567890") );
+    *a1 = aint("-987654321098765432109876543210"); CPPUNIT_ASSERT( (*a1 /= 11) == aint("-89786756463524130191806958473") );
 }
 
 // eof
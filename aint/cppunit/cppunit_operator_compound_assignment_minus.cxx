@@ -38,6 +38,11 @@ void aintTest::testOperatorCompoundAssignmentMinus()
     *a1 = 3; CPPUNIT_ASSERT( (*a1 -= 1UL)  == 2 );
     *a1 = 3; CPPUNIT_ASSERT( (*a1 -= 1ULL) == 2 );
     *a1 = 7; CPPUNIT_ASSERT( ((*a1 -= "1") -= "2") == 4 );
+
+    // in place, also with itself as operand
+    *a1 = aint("123456789012345678901234567890"); CPPUNIT_ASSERT( (*a1 -= *a1) == 0 );
+    *a1 = aint("123456789012345678901234567890"); CPPUNIT_ASSERT( (*a1 -= aint("-987654321098765432109876543210")) == aint("1111111110111111111011111111100") );
+    *a1 = aint("10000000000000000000000000000000000000000"); CPPUNIT_ASSERT( (*a1 -= 1) == aint("9999999999999999999999999999999999999999") );
 }
 
 // eof
@@ -38,6 +38,11 @@ void aintTest::testOperatorCompoundAssignmentModulo()
     *a1 = 13; CPPUNIT_ASSERT( (*a1 %= 2UL)  == 1 );
     *a1 = 13; CPPUNIT_ASSERT( (*a1 %= 2ULL) == 1 );
     *a1 = 17; CPPUNIT_ASSERT( ((*a1 %= "4") %= "2") == 1 );
+
+    // in place, also with itself as operand
+    *a1 = aint("123456789012345678901234567890"); CPPUNIT_ASSERT( (*a1 %= *a1) == 0 );
+    *a1 = aint("15241578753238836750495351562536198787501905199875019052105"); CPPUNIT_ASSERT( (*a1 %= aint("-123456789012345678901234567890")) == 5 );
+    *a1 = aint("-987654321098765432109876543210"); CPPUNIT_ASSERT( (*a1 %= 11) == -7 );
 }
 
 // eof
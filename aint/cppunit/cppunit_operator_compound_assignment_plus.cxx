@@ -38,6 +38,11 @@ void aintTest::testOperatorCompoundAssignmentPlus()
     *a1 = 1; CPPUNIT_ASSERT( (*a1 += 1UL)  == 2 );
     *a1 = 1; CPPUNIT_ASSERT( (*a1 += 1ULL) == 2 );
     *a1 = 1; CPPUNIT_ASSERT( ((*a1 += "1") += "2") == 4 );
+
+    // in place, also with itself as operand
+    *a1 = aint("123456789012345678901234567890"); CPPUNIT_ASSERT( (*a1 += *a1) == aint("246913578024691357802469135780") );
+    *a1 = aint("-123456789012345678901234567890"); CPPUNIT_ASSERT( (*a1 += *a1) == aint("-246913578024691357802469135780") );
+    *a1 = aint("9999999999999999999999999999999999999999"); CPPUNIT_ASSERT( (*a1 += 1) == aint("10000000000000000000000000000000000000000") );
 }
 
 // eof
@@ -38,6 +38,11 @@ void aintTest::testOperatorCompoundAssignmentTimes()
     *a1 = 3; CPPUNIT_ASSERT( (*a1 *= 4UL)  == 12 );
     *a1 = 3; CPPUNIT_ASSERT( (*a1 *= 4ULL) == 12 );
     *a1 = 3; CPPUNIT_ASSERT( ((*a1 *= "4") *= "5") == 60 );
+
+    // in place, also with itself as operand
+    *a1 = aint("123456789012345678901234567890"); CPPUNIT_ASSERT( (*a1 *= *a1) == aint("15241578753238836750495351562536198787501905199875019052100") );
+    *a1 = aint("123456789012345678901234567890"); CPPUNIT_ASSERT( (*a1 *= aint("-987654321098765432109876543210")) == aint("-121932631137021795226185032733622923332237463801111263526900") );
+    *a1 = aint("123456789012345678901234567890"); CPPUNIT_ASSERT( (*a1 *= -7) == aint("-864197523086419752308641975230") );
 }
 
 // eof
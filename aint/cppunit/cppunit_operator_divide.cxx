@@ -201,6 +201,46 @@ void aintTest::testOperatorDivide()
     *a1 = aint("-1000000000000000"); *a2 = aint("+1002985889"); ad = a1->div(*a2); CPPUNIT_ASSERT( (*a1) == (*a2) * ad.first + ad.second );
     *a1 = aint("+1000000000000000"); *a2 = aint("-1002985889"); ad = a1->div(*a2); CPPUNIT_ASSERT( (*a1) == (*a2) * ad.first + ad.second );
     *a1 = aint("-1000000000000000"); *a2 = aint("-1002985889"); ad = a1->div(*a2); CPPUNIT_ASSERT( (*a1) == (*a2) * ad.first + ad.second );
+    // long division examples for [D6] if using SINGLE_32 (decimal and binary radix)
+    *a1 = aint("500000001500000001500000001500000000"); *a2 = aint("500000001000000000500000001"); ad = a1->div(*a2);
+    CPPUNIT_ASSERT( ad.first == 1000000000 && ad.second == aint("500000001000000000500000000") );
+    *a1 = aint("664613999749367997109356201009741824"); *a2 = aint("618970020795611642593280001"); ad = a1->div(*a2);
+    CPPUNIT_ASSERT( ad.first == 1073741824 && ad.second == aint("618970020795611642593280000") );
+
+    // long division of several thousand digits, repeated with the same and with
+    // smaller operands (the temporaries are reused from the scratch arena)
+    for (int j = 0; j < 3; ++j) {
+        *a1 = aint(7).power(3000 - 1000 * j) + 12345; *a2 = aint(3).power(2000 - 700 * j) - 1; ad = a1->div(*a2);
+        CPPUNIT_ASSERT( (*a1) == (*a2) * ad.first + ad.second && ad.second >= 0 && ad.second < (*a2) );
+        *a1 = -(*a1); ad = a1->div(*a2);
+        CPPUNIT_ASSERT( (*a1) == (*a2) * ad.first + ad.second && ad.second <= 0 && -ad.second < (*a2) );
+    }
+
+    // recursive division of mid-size operands, also with a quotient shorter than
+    // the divisor
+    *a2 = aint(3).power(5000) - 1;
+    *a1 = (*a2) * (aint(7).power(600) + 1) + (*a2) - 1; ad = a1->div(*a2);
+    CPPUNIT_ASSERT( ad.first == aint(7).power(600) + 1 && ad.second == (*a2) - 1 );
+    *a1 = (*a2) * (*a2) - 1; ad = a1->div(*a2);
+    CPPUNIT_ASSERT( ad.first == (*a2) - 1 && ad.second == (*a2) - 1 );
+
+    // division with Newton's reciprocal (long divisor and quotient), also with the
+    // remainders 0 and divisor - 1
+    *a1 = aint(7).power(20000) + 12345; *a2 = aint(3).power(12000) - 1; ad = a1->div(*a2);
+    CPPUNIT_ASSERT( (*a1) == (*a2) * ad.first + ad.second && ad.second >= 0 && ad.second < (*a2) );
+    *a1 = (*a2) * (aint(5).power(9000) + 1); ad = a1->div(*a2);
+    CPPUNIT_ASSERT( ad.first == aint(5).power(9000) + 1 && ad.second == 0 );
+    *a1 -= 1; ad = a1->div(*a2);
+    CPPUNIT_ASSERT( ad.first == aint(5).power(9000) && ad.second == (*a2) - 1 );
+
+
+    // machine integers with more than one single component
+    CPPUNIT_ASSERT( aint("123456789012345678901234567890123") / 18446744073709551615ULL == aint("6692605942763") );
+    CPPUNIT_ASSERT( aint("123456789012345678901234567890123") / (-9223372036854775807LL - 1) == aint("-13385211885526") );
+    CPPUNIT_ASSERT( aint("-123456789012345678901234567890123") / 1000000007 == aint("-123456788148148161864197") );
+    CPPUNIT_ASSERT( 18446744073709551615ULL / aint("4294967296") == 4294967295ULL );
+    CPPUNIT_ASSERT( 12345 / aint("123456789012345678901234567890123") == 0 );
+    CPPUNIT_ASSERT( -100 / aint(7) == -14 && 100LL / aint(-7) == -14 );
 }
 
 // eof
@@ -94,6 +94,12 @@ void aintTest::testOperatorEqual()        {
 
     CPPUNIT_ASSERT( (*a1 = "1000000000000"  ) == aint( 1000000000000LL ) );
     CPPUNIT_ASSERT( (*a1 = std::string("1000000000000")  ) == aint( 1000000000000LL ) );
+
+
+    // machine integers with more than one single component
+    CPPUNIT_ASSERT( aint("-9223372036854775808") == (-9223372036854775807LL - 1) );
+    CPPUNIT_ASSERT( aint("18446744073709551615") == 18446744073709551615ULL );
+    CPPUNIT_ASSERT( !(aint("18446744073709551616") == 18446744073709551615ULL) );
 }
 
 // eof
@@ -49,6 +49,10 @@ void aintTest::testOperatorIncrement() {
     }
     CPPUNIT_ASSERT( *a1 == 10000 );
     CPPUNIT_ASSERT( *a2 == 10000 );
+
+    // carry into the higher components of negative values
+    *a1 = aint("-1000000000000000000"); ++(*a1); CPPUNIT_ASSERT( *a1 == aint("-999999999999999999") );
+    *a1 = aint("-4611686018427387904"); ++(*a1); CPPUNIT_ASSERT( *a1 == aint("-4611686018427387903") );
 }
 
 // eof
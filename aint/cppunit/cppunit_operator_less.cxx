@@ -193,6 +193,14 @@ void aintTest::testOperatorLess() {
     CPPUNIT_ASSERT(              0UL  < aint("+1000000000000") ); // less where lhs == 0 and rhs > 0
     CPPUNIT_ASSERT(  1000000000000ULL < aint("+2000000000000") ); // less where lhs > 0 and rhs > 0
     CPPUNIT_ASSERT(              0ULL < aint("+1000000000000") ); // less where lhs == 0 and rhs > 0
+
+
+    // machine integers with more than one single component
+    CPPUNIT_ASSERT( aint("-9223372036854775809") < (-9223372036854775807LL - 1) );
+    CPPUNIT_ASSERT( !(aint("-9223372036854775808") < (-9223372036854775807LL - 1)) );
+    CPPUNIT_ASSERT( (-9223372036854775807LL - 1) < aint("-9223372036854775807") );
+    CPPUNIT_ASSERT( aint("18446744073709551614") < 18446744073709551615ULL );
+    CPPUNIT_ASSERT( !(aint("18446744073709551616") < 18446744073709551615ULL) );
 }
 
 // eof
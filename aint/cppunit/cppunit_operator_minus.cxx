@@ -181,6 +181,19 @@ void aintTest::testOperatorMinus() {
     CPPUNIT_ASSERT( (+2000000000000000000ULL) - aint("-2000000000000000000") == -aint("-4000000000000000000") );
     CPPUNIT_ASSERT( (+1000000000000000000ULL) - aint("-2000000000000000000") == -aint("-3000000000000000000") );
     CPPUNIT_ASSERT( (+2000000000000000000ULL) - aint("-1000000000000000000") == -aint("-3000000000000000000") );
+
+    // expiring operands which take the result
+    aint a("123456789012345678901234567890"), b("-987654321098765432109876543210"), c(a);
+    CPPUNIT_ASSERT( a * a - b * b == aint("-960219479231824415836762688373113854558175582987903978052000") );
+    CPPUNIT_ASSERT( a - b * 2 - a == aint("1975308642197530864219753086420") );
+    CPPUNIT_ASSERT( b - std::move(c) == aint("-1111111110111111111011111111100") );
+    c = a;
+    CPPUNIT_ASSERT( std::move(c) - b == aint("1111111110111111111011111111100") );
+    CPPUNIT_ASSERT( aint("1" + std::string(40, '0')) - aint(1) == aint(std::string(40, '9')) );
+    CPPUNIT_ASSERT( -a == aint("-123456789012345678901234567890") && a == -(-a) );
+    CPPUNIT_ASSERT( -aint(0) == aint(0) && -(-b) == b );
+    CPPUNIT_ASSERT( 5 - aint(7) == -2 && 0ULL - aint("123456789012345678901234567890123") == aint("-123456789012345678901234567890123") );
+    CPPUNIT_ASSERT( aint("-9223372036854775808") - (-9223372036854775807LL - 1) == 0 );
 }
 
 // eof
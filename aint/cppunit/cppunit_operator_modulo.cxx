@@ -181,6 +181,31 @@ void aintTest::testOperatorModulo()
     CPPUNIT_ASSERT( aint("387108630501980")           % aint("889673364")              == aint("184071848") );
     CPPUNIT_ASSERT( aint("9561835063")                % aint("68813")                  == aint("62274") );
     CPPUNIT_ASSERT( aint("204005197")                 % aint("284")                    == aint("45") );
+
+
+    // machine integers with more than one single component
+    CPPUNIT_ASSERT( aint("123456789012345678901234567890123") % 18446744073709551615ULL == aint("8982052289483677878") );
+    CPPUNIT_ASSERT( aint("-123456789012345678901234567890123") % (-9223372036854775807LL - 1) == aint("-8982045596877735115") );
+    CPPUNIT_ASSERT( aint("-123456789012345678901234567890123") % 1000000007 == aint("-434840744") );
+    CPPUNIT_ASSERT( 18446744073709551615ULL % aint("123456789012345678901234567890123") == 18446744073709551615ULL );
+    CPPUNIT_ASSERT( 100 % aint(-7) == 2 && -100L % aint(7) == -2 );
+
+    // reduction by a fixed modulus (the same results as with the modulus, also for
+    // values beyond the square of the modulus)
+    aint::barrett r(aint(3).power(2000) - 1);
+    aint x = aint(7).power(1000);
+    aint y = aint(5).power(1500) + 1;
+    for (int j = 0; j < 20; ++j) {
+        aint z = x * y;
+        CPPUNIT_ASSERT( z % r == z % r.modulus() && (-z) % r == (-z) % r.modulus() );
+        x = z % r;
+        y += j;
+    }
+    x *= r.modulus();
+    CPPUNIT_ASSERT( x % r == 0 && (x - 1) % r == r.modulus() - 1 && (x * x + 5) % r == 5 );
+    x = aint("-123456789012345678901234567890123");
+    x %= aint::barrett(-1000000007);
+    CPPUNIT_ASSERT( x == aint("-434840744") && aint(100) % aint::barrett(7) == 2 );
 }
 
 // eof
@@ -182,6 +182,18 @@ void aintTest::testOperatorPlus() {
     CPPUNIT_ASSERT( (+2000000000000000000ULL) + aint("-2000000000000000000") == aint("+0"                  ) );
     CPPUNIT_ASSERT( (+1000000000000000000ULL) + aint("-2000000000000000000") == aint("-1000000000000000000") );
     CPPUNIT_ASSERT( (+2000000000000000000ULL) + aint("-1000000000000000000") == aint("+1000000000000000000") );
+
+    // expiring operands which take the result
+    aint a("123456789012345678901234567890"), b("-987654321098765432109876543210"), c(a);
+    CPPUNIT_ASSERT( a * a + b * b == aint("990702636738302089337753391498186252133179393387654016156200") );
+    CPPUNIT_ASSERT( a + b * 2 + a == aint("-1728395064172839506417283950640") );
+    CPPUNIT_ASSERT( a + std::move(c) == aint("246913578024691357802469135780") );
+    c = a;
+    CPPUNIT_ASSERT( std::move(c) + a == aint("246913578024691357802469135780") );
+    CPPUNIT_ASSERT( aint(std::string(40, '9')) + aint(1) == aint("1" + std::string(40, '0')) );
+    CPPUNIT_ASSERT( +a == a && a == aint("123456789012345678901234567890") );
+    CPPUNIT_ASSERT( (-9223372036854775807LL - 1) + aint("9223372036854775808") == 0 );
+    CPPUNIT_ASSERT( aint("-123456789012345678901234567890123") + 18446744073709551615ULL == aint("-123456789012327232157160858338508") );
 }
 
 // eof
@@ -158,6 +158,98 @@ void aintTest::testOperatorTimes() {
     CPPUNIT_ASSERT( (+2000000000000000000ULL) * aint("-2000000000000000000") == aint("-4000000000000000000000000000000000000") );
     CPPUNIT_ASSERT( (+1000000000000000000ULL) * aint("-2000000000000000000") == aint("-2000000000000000000000000000000000000") );
     CPPUNIT_ASSERT( (+2000000000000000000ULL) * aint("-1000000000000000000") == aint("-2000000000000000000000000000000000000") );
+
+    CPPUNIT_ASSERT( aint("+0") * aint("-20000000000") == 0 );
+    CPPUNIT_ASSERT( aint("-20000000000") * aint("+0") == 0 );
+
+    // large factors (Karatsuba's algorithm)
+    const std::string n900(900, '9');
+    CPPUNIT_ASSERT( aint(n900) * aint(n900) == aint(std::string(899, '9') + "8" + std::string(899, '0') + "1") );
+    CPPUNIT_ASSERT( aint("-" + n900) * aint(n900) == aint("-" + std::string(899, '9') + "8" + std::string(899, '0') + "1") );
+    CPPUNIT_ASSERT( aint(n900) * aint("-" + n900) == aint("-" + std::string(899, '9') + "8" + std::string(899, '0') + "1") );
+    CPPUNIT_ASSERT( aint(std::string(2000, '9')) * aint(std::string(500, '9')) == aint(std::string(499, '9') + "8" + std::string(1500, '9') + std::string(499, '0') + "1") );
+
+    // squares (both factors are the same object)
+    for (size_t d = 50; d <= 900; d *= 3) {
+        const aint x("-" + std::string(d, '9'));
+        CPPUNIT_ASSERT( x * x == aint(std::string(d - 1, '9') + "8" + std::string(d - 1, '0') + "1") );
+    }
+
+    // factors in the band of the Toom-3 algorithm of TIMES_AUTO (between the default
+    // C_TIMES_TOOM3_THRESHOLD and C_TIMES_FFT_THRESHOLD of about 400 single components
+    // for 2, 4, 9 or 18 decimal digits per single component)
+    CPPUNIT_ASSERT( aint::getTimesAlgorithm() == aint::TIMES_AUTO );
+    const size_t toomDigits[] = { 800, 1650, 3700, 7400 };
+    for (size_t j = 0; j < 4; ++j) {
+        const size_t d = toomDigits[j];
+        const std::string nd(d, '9');
+        CPPUNIT_ASSERT( aint(nd) * aint("-" + nd) == aint("-" + std::string(d - 1, '9') + "8" + std::string(d - 1, '0') + "1") );
+        const aint x(nd);
+        CPPUNIT_ASSERT( x * x == aint(std::string(d - 1, '9') + "8" + std::string(d - 1, '0') + "1") );
+        const aint y = aint(7).power(aint(d * 6 / 5));
+        const aint z = aint(3).power(aint(d * 21 / 10)) + 1;
+        CPPUNIT_ASSERT( (y * z) % 1000003 == (y % 1000003) * (z % 1000003) % 1000003 );
+    }
+
+    // large factors (with each algorithm for large factors, where TIMES_SSA
+    // uses the Toom-3 and Toom-4 algorithm for the smaller ones)
+    CPPUNIT_ASSERT( aint::getTimesAlgorithm() == aint::TIMES_AUTO );
+    const std::string n40k(40000, '9');
+    std::string s40k;
+    for (size_t j = 0; j < 5000; ++j) {
+        s40k += "31415926";
+    }
+    const aint::timesAlgorithm algos[] = { aint::TIMES_SSA, aint::TIMES_NTT, aint::TIMES_FFT, aint::TIMES_AUTO };
+    aint p40k;
+    for (size_t a = 0; a < 4; ++a) {
+        aint::setTimesAlgorithm(algos[a]);
+        CPPUNIT_ASSERT( aint::getTimesAlgorithm() == algos[a] );
+        for (size_t d = 3000; d <= 12000; d *= 2) {
+            const std::string nd(d, '9');
+            CPPUNIT_ASSERT( aint(nd) * aint("-" + nd) == aint("-" + std::string(d - 1, '9') + "8" + std::string(d - 1, '0') + "1") );
+            CPPUNIT_ASSERT( aint(nd + nd) * aint("1" + std::string(d - 1, '0') + "1") == aint("1" + std::string(d, '0') + std::string(d - 1, '9') + "8" + nd) );
+            const aint x(nd);
+            CPPUNIT_ASSERT( x * x == aint(std::string(d - 1, '9') + "8" + std::string(d - 1, '0') + "1") );
+        }
+        CPPUNIT_ASSERT( aint(n40k) * aint("-" + n40k) == aint("-" + std::string(39999, '9') + "8" + std::string(39999, '0') + "1") );
+        // unbalanced factors (the longer one is split into blocks)
+        for (size_t d = 1000; d <= 9000; d *= 3) {
+            CPPUNIT_ASSERT( aint(n40k) * aint(std::string(d, '9')) == aint(std::string(d - 1, '9') + "8" + std::string(40000 - d, '9') + std::string(d - 1, '0') + "1") );
+        }
+        const aint x40k(s40k);
+        CPPUNIT_ASSERT( x40k * x40k == aint(s40k) * aint(s40k) );
+        if (a == 0) {
+            p40k = aint(s40k) * aint(n40k + s40k);
+        } else {
+            CPPUNIT_ASSERT( aint(s40k) * aint(n40k + s40k) == p40k );
+        }
+    }
+
+    // large factors with one and more than one thread (the number-theoretic transform
+    // is used above its crossover of several thousand single components only)
+    CPPUNIT_ASSERT( aint::getThreads() == 1 );
+    aint::setThreads(0);
+    CPPUNIT_ASSERT( aint::getThreads() >= 1 );
+    const aint x80k(s40k + n40k);
+    const aint y80k(n40k + s40k);
+    const aint p80k = x80k * y80k;
+    const aint q80k = x80k * x80k;
+    for (size_t a = 0; a < 4; ++a) {
+        aint::setTimesAlgorithm(algos[a]);
+        for (unsigned int t = 1; t <= 4; ++t) {
+            aint::setThreads(t);
+            CPPUNIT_ASSERT( aint::getThreads() == t );
+            CPPUNIT_ASSERT( x80k * y80k == p80k );
+            CPPUNIT_ASSERT( x80k * x80k == q80k );
+        }
+    }
+    aint::setThreads(1);
+
+    // machine integers with more than one single component
+    CPPUNIT_ASSERT( aint("123456789012345678901234567890123") * (-9223372036854775807LL - 1) == aint("-1138687895536349070124195419012415328766238742544384") );
+    CPPUNIT_ASSERT( aint("-123456789012345678901234567890123") * 18446744073709551615ULL == aint("-2277375791072698140124934049012484978631242917198645") );
+    CPPUNIT_ASSERT( 4294967296LL * aint("-123456789012345678901234567890123") == aint("-530242871277196831127719683112770006417408") );
+    CPPUNIT_ASSERT( aint("123456789012345678901234567890123") * 0ULL == 0 );
 }
 
 // eof
@@ -28,36 +28,169 @@
 
 #include "impl.hxx"
 
-namespace {
-
-// array with powers of 10
-const size_t power10[10] = {
-    1,
-    10,
-    100,
-    1000,
-    10000,
-    100000,
-    1000000,
-    10000000,
-    100000000,
-    1000000000
-};
-
-} // end of namespace
+//
+// default thresholds of the algorithms, a header generated by aint-tune
+// (see aint/tune) replaces them with the values measured on the build host
+//
+#if defined(AINT_TUNED)
+#include "aint_tune.hxx"
+#endif
+#if ! defined(AINT_TIMES_KARATSUBA_THRESHOLD)
+#define AINT_TIMES_KARATSUBA_THRESHOLD 96
+#endif
+#if ! defined(AINT_SQUARE_KARATSUBA_THRESHOLD)
+#define AINT_SQUARE_KARATSUBA_THRESHOLD 192
+#endif
+#if ! defined(AINT_TIMES_TOOM3_THRESHOLD)
+#define AINT_TIMES_TOOM3_THRESHOLD 384
+#endif
+#if ! defined(AINT_TIMES_TOOM4_THRESHOLD)
+#define AINT_TIMES_TOOM4_THRESHOLD 640
+#endif
+#if ! defined(AINT_TIMES_SSA_THRESHOLD)
+#define AINT_TIMES_SSA_THRESHOLD 4096
+#endif
+#if ! defined(AINT_TIMES_NTT_THRESHOLD)
+#define AINT_TIMES_NTT_THRESHOLD 4800
+#endif
+#if ! defined(AINT_TIMES_FFT_THRESHOLD)
+#define AINT_TIMES_FFT_THRESHOLD 448
+#endif
+#if ! defined(AINT_SQUARE_FFT_THRESHOLD)
+#define AINT_SQUARE_FFT_THRESHOLD 640
+#endif
+#if ! defined(AINT_TIMES_FFT_NTT_THRESHOLD)
+#define AINT_TIMES_FFT_NTT_THRESHOLD 32768
+#endif
+#if ! defined(AINT_SQUARE_FFT_NTT_THRESHOLD)
+#define AINT_SQUARE_FFT_NTT_THRESHOLD 8192
+#endif
+#if ! defined(AINT_DIVIDE_BZ_THRESHOLD)
+#define AINT_DIVIDE_BZ_THRESHOLD 40
+#endif
+#if ! defined(AINT_DIVIDE_NEWTON_THRESHOLD)
+#define AINT_DIVIDE_NEWTON_THRESHOLD 500
+#endif
+#if ! defined(AINT_TIMES_THREADS_THRESHOLD)
+#define AINT_TIMES_THREADS_THRESHOLD 8192
+#endif
 
 namespace astd {
 
 //
-// width of a singleComp
+// width and maximum number (plus 1) of a singleComp and of the decimal
+// components (constant expressions, see impl.hxx)
+//
+const int aint::impl::C_SINGLE_COMP_WIDTH;
+const aint::impl::singleComp aint::impl::C_SINGLE_COMP_MAX_P1;
+const int aint::impl::C_DECIMAL_WIDTH;
+const aint::impl::singleComp aint::impl::C_DECIMAL_MAX_P1;
+
+//
+// number of single components stored inline in the data container and
+// number of single components of an unsigned long long int
+//
+const size_t aint::impl::C_DATA_INLINE;
+const size_t aint::impl::C_ULL_COMPS;
+const unsigned long long int aint::impl::C_ULL_DIVISOR_MAX;
+
+//
+// number of partial products (each less than (C_SINGLE_COMP_MAX_P1 - 1)^2)
+// which can be added to a value less than 3 * C_SINGLE_COMP_MAX_P1 without
+// overflowing a productComp (18 for SINGLE_32, 340 for SINGLE_64)
+//
+const size_t aint::impl::C_TIMES_COMBA_GROUP = static_cast<size_t>(
+    (static_cast<productComp>(-1) - 3 * static_cast<productComp>(C_SINGLE_COMP_MAX_P1)) /
+    ((static_cast<productComp>(C_SINGLE_COMP_MAX_P1) - 1) * (static_cast<productComp>(C_SINGLE_COMP_MAX_P1) - 1)));
+
+//
+// below this size (of the shorter factor) the schoolbook multiplication
+// is faster than Karatsuba's algorithm
+//
+aint::impl::threshold aint::impl::C_TIMES_KARATSUBA_THRESHOLD = AINT_TIMES_KARATSUBA_THRESHOLD;
+
+//
+// below this size the schoolbook squaring is faster than Karatsuba's
+// algorithm (it computes only half of the partial products)
+//
+aint::impl::threshold aint::impl::C_SQUARE_KARATSUBA_THRESHOLD = AINT_SQUARE_KARATSUBA_THRESHOLD;
+
+//
+// below these sizes (of the shorter factor) Karatsuba's algorithm
+// is faster than the Toom-3 algorithm and the Toom-3 algorithm is
+// faster than the Toom-4 algorithm
+//
+aint::impl::threshold aint::impl::C_TIMES_TOOM3_THRESHOLD = AINT_TIMES_TOOM3_THRESHOLD;
+aint::impl::threshold aint::impl::C_TIMES_TOOM4_THRESHOLD = AINT_TIMES_TOOM4_THRESHOLD;
+
+//
+// below this size (of the shorter factor) the Toom-Cook algorithms
+// are faster than the Schoenhage-Strassen algorithm
+//
+aint::impl::threshold aint::impl::C_TIMES_SSA_THRESHOLD = AINT_TIMES_SSA_THRESHOLD;
+
+//
+// below this size (of the shorter factor) the Toom-Cook algorithms
+// are faster than the number-theoretic transform; the Schoenhage-Strassen
+// algorithm is used if it is selected or the factors are too long for
+// the number-theoretic transform
+//
+aint::impl::threshold aint::impl::C_TIMES_NTT_THRESHOLD = AINT_TIMES_NTT_THRESHOLD;
+
+//
+// below this size (of the shorter factor) the Toom-Cook algorithms
+// are faster than the floating-point FFT
+//
+aint::impl::threshold aint::impl::C_TIMES_FFT_THRESHOLD = AINT_TIMES_FFT_THRESHOLD;
+
+//
+// below this size the Karatsuba and Toom-Cook squares are faster than
+// the floating-point FFT (which needs two transforms for squares, too)
+//
+aint::impl::threshold aint::impl::C_SQUARE_FFT_THRESHOLD = AINT_SQUARE_FFT_THRESHOLD;
+
+//
+// from these sizes (of the shorter factor and of a square) on the number-theoretic
+// transform is faster than a floating-point FFT which is more than twice as long
+// (the FFT splits the single components into fewer digits than the NTT, but
+// needs 2 transforms instead of 9, or 6 for squares); the FFT of at most twice
+// the length of the NTT is faster at all sizes
+//
+aint::impl::threshold aint::impl::C_TIMES_FFT_NTT_THRESHOLD = AINT_TIMES_FFT_NTT_THRESHOLD;
+aint::impl::threshold aint::impl::C_SQUARE_FFT_NTT_THRESHOLD = AINT_SQUARE_FFT_NTT_THRESHOLD;
+
+//
+// below these sizes (of the divisor and of the quotient) the long division
+// (Knuth's algorithm D) is faster than the recursive division of Burnikel
+// and Ziegler and the recursive division is faster than the division with
+// Newton's reciprocal (which needs a few products of the size of the divisor)
+//
+aint::impl::threshold aint::impl::C_DIVIDE_BZ_THRESHOLD = AINT_DIVIDE_BZ_THRESHOLD;
+aint::impl::threshold aint::impl::C_DIVIDE_NEWTON_THRESHOLD = AINT_DIVIDE_NEWTON_THRESHOLD;
+
+//
+// if the longer factor is more than this many times longer than the shorter
+// one, it is split into blocks of at most this many times the size of the
+// shorter one, so that the blocks are multiplied with a balanced algorithm
+// (the transforms then work on the length of a block instead of the product)
+//
+const size_t aint::impl::C_TIMES_UNBALANCED_RATIO = 4;
+
+//
+// algorithm for the multiplication of large factors
+//
+aint::timesAlgorithm aint::impl::timesAlgorithm_ = aint::TIMES_AUTO;
+
 //
-// NOTE: 2.408 ~= log(2) * 8, where 8 is the number of bits per byte
+// minimum size of the shorter factor for the multiplication with more than one
+// thread: the transforms are split into independent parts, smaller products do
+// not pay for the start of the threads
 //
-const int aint::impl::C_SINGLE_COMP_WIDTH  = (int) (2.408 * sizeof(singleComp));
+aint::impl::threshold aint::impl::C_TIMES_THREADS_THRESHOLD = AINT_TIMES_THREADS_THRESHOLD;
 
 //
-// maximum number (plus 1) stored in a singleComp type
+// maximum number of threads for the multiplication of large factors
 //
-const aint::impl::singleComp aint::impl::C_SINGLE_COMP_MAX_P1 = power10[C_SINGLE_COMP_WIDTH];
+unsigned int aint::impl::threads_ = 1;
 
 } // end of namespace astd
@@ -27,6 +27,7 @@
 // impl_ctor.cxx (impl ctor(s))
 
 #include "impl.hxx"
+#include <new> // placement new
 
 namespace astd {
 
@@ -60,30 +61,49 @@ void aint::impl::ctorC(const char* s) {
         ++sL;
         ++ps;
     }
-    size_t sLd = sL / C_SINGLE_COMP_WIDTH;
-    size_t sLm = sL % C_SINGLE_COMP_WIDTH;
+    size_t sLd = sL / C_DECIMAL_WIDTH;
+    size_t sLm = sL % C_DECIMAL_WIDTH;
     size_t dim = sLd + (sLm > 0 ? 1 : 0);
-    d.resize(dim);
+#if defined(BINARY_RADIX)
+    // split into decimal components and convert them to single components
+    data c;
+    const size_t cL = dim;
+#else
+    data& c = d;
+#endif
+    c.resize(dim);
     singleComp x = 0;
     if (sLm > 0) {
         for (int j = 0; j < sLm; ++j) {
             x = 10 * x + ((*s) - '0');
             ++s;
         }
-        d[--dim] = x;
+        c[--dim] = x;
     }
     for (int j = 0; j < sLd; ++j) {
         x = 0;
-        for (int i = 0; i < C_SINGLE_COMP_WIDTH; ++i) {
+        for (int i = 0; i < C_DECIMAL_WIDTH; ++i) {
             x = 10 * x + ((*s) - '0');
             ++s;
         }
-        d[--dim] = x;
+        c[--dim] = x;
     }
+#if defined(BINARY_RADIX)
+    if (cL > 0) {
+        radixPowers powers;
+        d.resize(cL);
+        decimalToLimbs(c.data(), cL, d.data(), powers);
+        this->removeLeadingZeros();
+    }
+#endif
 }
 
 void aint::impl::ctorLL(const long long int i) {
+#if defined(BINARY_RADIX)
+    const int C_INT_WIDTH = (int) (8 * sizeof(long long int));
+#else
     const int C_INT_WIDTH = (int) (2.408 * sizeof(long long int));
+#endif
     this->clear();
     this->data_.reserve(C_INT_WIDTH / aint::impl::C_SINGLE_COMP_WIDTH + 1);
     singleComp mod = 0;
@@ -100,7 +120,11 @@ void aint::impl::ctorLL(const long long int i) {
 }
 
 void aint::impl::ctorULL(const unsigned long long int i) {
+#if defined(BINARY_RADIX)
+    const int C_INT_WIDTH = (int) (8 * sizeof(unsigned long long int));
+#else
     const int C_INT_WIDTH = (int) (2.408 * sizeof(unsigned long long int));
+#endif
     this->clear();
     this->data_.reserve(C_INT_WIDTH / aint::impl::C_SINGLE_COMP_WIDTH + 1);
     singleComp mod = 0;
@@ -144,5 +168,50 @@ aint::impl::impl(const impl& a) { // copy ctor
     positive_ = a.positive_;
     data_ = a.data_;
 }
+aint::impl::impl(impl&& a) : positive_(a.positive_), data_(std::move(a.data_)) { // move ctor
+    a.positive_ = true;
+    a.data_.push_back(0);
+}
+
+aint::impl& aint::impl::operator=(const impl& a) {
+    positive_ = a.positive_;
+    data_ = a.data_;
+    return(*this);
+}
+aint::impl& aint::impl::operator=(impl&& a) {
+    if (this != &a) {
+        positive_ = a.positive_;
+        data_ = std::move(a.data_);
+        a.positive_ = true;
+        a.data_.push_back(0);
+    }
+    return(*this);
+}
+
+const aint::impl& aint::impl::zero() {
+    static const impl z;
+    return(z);
+}
+
+aint::impl* aint::impl::create(size_t capacity) {
+    // the single components follow the impl in the same block (sizeof(impl) is a
+    // multiple of the alignment of its pointers and so of a singleComp), small
+    // values use the inline buffer of the data container
+    const bool trailing = (capacity > C_DATA_INLINE);
+    void* p = memory::allocate(sizeof(impl) + (trailing ? capacity * sizeof(singleComp) : 0));
+    impl* a = ::new (p) impl();
+    if (trailing) {
+        a->data_.setLocal(reinterpret_cast<singleComp*>(static_cast<char*>(p) + sizeof(impl)), capacity);
+    }
+    return(a);
+}
+void* aint::impl::operator new(size_t size) {
+    return(memory::allocate(size));
+}
+aint::impl* aint::impl::create(const impl& a) {
+    impl* b = create(a.data_.size());
+    *b = a;
+    return(b);
+}
 
 } // end of namespace astd
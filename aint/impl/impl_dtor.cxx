@@ -34,4 +34,17 @@ aint::impl::~impl() {
     data_.clear();
 }
 
+void aint::impl::destroy(impl* a) {
+    // the size of the block is known before the dtor only, since an impl allocated
+    // by create is followed by its local buffer (see impl::create)
+    size_t local = a->data_.localCapacity();
+    size_t size  = sizeof(impl) + (local > C_DATA_INLINE ? local * sizeof(singleComp) : 0);
+    a->~impl();
+    memory::free(a, size);
+}
+
+void aint::impl::operator delete(void* p, size_t size) {
+    memory::free(p, size);
+}
+
 } // end of namespace astd
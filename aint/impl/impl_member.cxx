@@ -56,12 +56,12 @@ aint aint::impl::factorialIterative(const aint& n) const {
     };
     const size_t facTableSize = sizeof(facTable) / sizeof(facTable[0]);
     if (n < facTableSize) {
-        aint fac = facTable[n.impl_->data_[0]];
+        aint fac = facTable[n.pimpl()->data_[0]];
         return(fac);
     }
     aint fac = facTable[facTableSize - 1];
     for (size_t j = facTableSize; j <= n; ++j) {
-        fac = fac * j;
+        fac *= j;
     }
     return(fac);
 }
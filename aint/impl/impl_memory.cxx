@@ -0,0 +1,84 @@
+/*
+ *  This file is part of aint.
+ *
+ *  aint provides a C++ class for arbitrary long integers which can be
+ *  used the same way as the C/C++ integer types (e.g. int or long),
+ *  but has no restriction on the length (if there is enough memory).
+ *  Aim of this project is to include fast integer multiplications
+ *  like the Toom-Cook algorithm or the Schoenhage-Strassen algorithm.
+ *  Copyright (C) 2014 Mario Baumann (mario-baumann@web.de)
+ *
+ *  aint is free software: you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  aint is distributed in the hope that it will be useful, but
+ *  WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with aint.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************/
+
+// arbitrary long integer
+// impl_memory.cxx (memory functions for all memory of aint)
+
+#include "impl_memory.hxx"
+#include <algorithm> // std::min
+#include <cstring>   // std::memcpy
+#include <new>       // operator new, operator delete, std::bad_alloc
+
+namespace astd {
+
+//
+// All memory of aint is allocated by the functions below, which call the
+// functions set by aint::setMemoryFunctions (similar to GMP's memory
+// functions). The functions may return NULL if there is not enough memory,
+// memory::allocate and memory::reallocate throw std::bad_alloc then, so
+// that aint behaves the same way with the default functions and with
+// C-style functions like malloc.
+//
+
+aint::allocateFunction   memory::allocate_   = &memory::defaultAllocate;
+aint::reallocateFunction memory::reallocate_ = &memory::defaultReallocate;
+aint::freeFunction       memory::free_       = &memory::defaultFree;
+
+void* memory::allocate(size_t size) {
+    void* p = allocate_(size);
+    if (p == NULL) {
+        throw std::bad_alloc();
+    }
+    return(p);
+}
+
+void* memory::reallocate(void* p, size_t oldSize, size_t newSize) {
+    void* q = reallocate_(p, oldSize, newSize);
+    if (q == NULL) {
+        throw std::bad_alloc();
+    }
+    return(q);
+}
+
+void memory::free(void* p, size_t size) {
+    free_(p, size);
+}
+
+void* memory::defaultAllocate(size_t size) {
+    return(::operator new(size));
+}
+
+void* memory::defaultReallocate(void* p, size_t oldSize, size_t newSize) {
+    void* q = ::operator new(newSize);
+    std::memcpy(q, p, std::min(oldSize, newSize));
+    ::operator delete(p);
+    return(q);
+}
+
+void memory::defaultFree(void* p, size_t /* size */) {
+    ::operator delete(p);
+}
+
+} // end of namespace astd
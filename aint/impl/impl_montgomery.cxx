@@ -0,0 +1,138 @@
+/*
+ *  This file is part of aint.
+ *
+ *  aint provides a C++ class for arbitrary long integers which can be
+ *  used the same way as the C/C++ integer types (e.g. int or long),
+ *  but has no restriction on the length (if there is enough memory).
+ *  Aim of this project is to include fast integer multiplications
+ *  like the Toom-Cook algorithm or the Schoenhage-Strassen algorithm.
+ *  Copyright (C) 2014 Mario Baumann (mario-baumann@web.de)
+ *
+ *  aint is free software: you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  aint is distributed in the hope that it will be useful, but
+ *  WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with aint.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************/
+
+// arbitrary long integer
+// impl_montgomery.cxx (helper functions for Montgomery's multiplication)
+
+#include "impl.hxx"
+#include <algorithm> // std::copy, std::fill, std::min
+
+namespace astd {
+
+bool aint::impl::montgomeryInverse(const aint& m, aint& mi) {
+    // x = m^-1 mod B with the extended Euclidean algorithm, then x = x * (2 - m * x) mod B^2k
+    // doubles the number k of correct single components (Hensel's lifting), and mi = B^n - x
+    const data& v = m.pimpl()->data_;
+    size_t n = v.size();
+    doubleComp r0 = C_SINGLE_COMP_MAX_P1;
+    doubleComp r1 = v[0];
+    doubleComp s0 = 0;
+    doubleComp s1 = 1;
+    while (r1 != 0) {
+        doubleComp q = r0 / r1;
+        doubleComp r = r0 - q * r1;
+        doubleComp s = s0 - q * s1;
+        r0 = r1;
+        r1 = r;
+        s0 = s1;
+        s1 = s;
+    }
+    if (r0 != 1) {
+        return(false);
+    }
+    singleComp x0 = static_cast<singleComp>(s0 < 0 ? s0 + C_SINGLE_COMP_MAX_P1 : s0);
+    aint x;
+    limbsToAint(&x0, 1, x);
+    aint e;
+    aint f;
+    // keeps the lower l single components of a
+    auto truncate = [](aint& a, size_t l) {
+        if (a.pimpl()->data_.size() > l) {
+            a.pimpl()->data_.resize(l);
+            a.pimpl()->removeLeadingZeros();
+        }
+    };
+    for (size_t k = 1; k < n; k *= 2) {
+        size_t l = std::min(2 * k, n);
+        // e = m * x mod B^l (e = 1 mod B^k), x = x * (B^l + 2 - e) mod B^l
+        e = m * x;
+        truncate(e, l);
+        shiftComps(aint(1), static_cast<long>(l), f);
+        f += 2;
+        f -= e;
+        x *= f;
+        truncate(x, l);
+    }
+    shiftComps(aint(1), static_cast<long>(n), mi);
+    mi -= x;
+    return(true);
+}
+
+void aint::impl::montgomeryReduce(singleComp* w, singleComp* t, const singleComp* v, size_t n, const singleComp* x) {
+    // add q * v to t, where q = -t * v^-1 mod B^n, so that the lower n single components of t
+    // become zero, see A.Menezes, P.van Oorschot, S.Vanstone, Handbook of Applied Cryptography,
+    // 14.32 and 14.36, with two products of the fastest algorithm for the size instead of the
+    // reduction word by word; then t / B^n < 2 * v
+    scratchBuffer<singleComp> q(2 * n);
+    operatorTimesLimbs(q.data(), t, n, x, n);
+    scratchBuffer<singleComp> p(2 * n);
+    operatorTimesLimbs(p.data(), q.data(), n, v, n);
+    limbsAdd(t, t, 2 * n + 1, p.data(), 2 * n);
+    if (limbsCmp(t + n, n + 1, v, n) >= 0) {
+        limbsSub(t + n, t + n, n + 1, v, n);
+    }
+    std::copy(t + n, t + 2 * n, w);
+}
+
+void aint::impl::montgomeryTimes(singleComp* w, const singleComp* a, const singleComp* b, const singleComp* v, size_t n, const singleComp* x) {
+    // operatorTimesLimbs squares if a is identical to b
+    scratchBuffer<singleComp> t(2 * n + 1);
+    operatorTimesLimbs(t.data(), a, n, b, n);
+    t[2 * n] = 0;
+    montgomeryReduce(w, t.data(), v, n, x);
+}
+
+void aint::impl::montgomeryTimes(const aint& a, const aint& b, const aint& m, const aint& mi, aint& res) {
+    // the operands are copied to n single components (with leading zeros), so res may be a or b;
+    // operands outside of [0, m) are reduced modulo m before
+    const data& v = m.pimpl()->data_;
+    size_t n = v.size();
+    scratchBuffer<singleComp> x(n, 0);
+    std::copy(mi.pimpl()->data_.begin(), mi.pimpl()->data_.end(), x.data());
+    auto load = [&](const aint& c, singleComp* u) {
+        const data& d = c.pimpl()->data_;
+        if (c.pimpl()->positive_ && limbsCmp(d.data(), d.size(), v.data(), n) < 0) {
+            std::copy(d.begin(), d.end(), u);
+        } else {
+            aint r = c % m;
+            if (!r.pimpl()->positive_) {
+                r += m;
+            }
+            std::copy(r.pimpl()->data_.begin(), r.pimpl()->data_.end(), u);
+        }
+    };
+    scratchBuffer<singleComp> u(n, 0);
+    load(a, u.data());
+    if (&a == &b) {
+        montgomeryTimes(u.data(), u.data(), u.data(), v.data(), n, x.data());
+    } else {
+        scratchBuffer<singleComp> w(n, 0);
+        load(b, w.data());
+        montgomeryTimes(u.data(), u.data(), w.data(), v.data(), n, x.data());
+    }
+    limbsToAint(u.data(), n, res);
+}
+
+} // end of namespace astd
@@ -27,6 +27,7 @@
 // impl_operator.cxx (helper functions for operators)
 
 #include "impl.hxx"
+#include <algorithm> // std::copy, std::copy_backward, std::fill, std::max
 
 namespace astd {
 
@@ -46,18 +47,174 @@ void aint::impl::removeLeadingZeros() {
     }
 }
 
-void aint::impl::resizeAndZeroise(size_t size) {
-    data& d = this->data_;
-    d.resize(size);
-    std::fill(d.begin(), d.end(), 0);
-}
-
 void aint::impl::makeZeroPositive() {
     if (!this->positive_ && this->data_.size() == 1 && this->data_[0] == 0) {
         this->positive_ = true;
     }
 }
 
+size_t aint::impl::limbsSize(const singleComp* u, size_t m) {
+    while (m > 0 && u[m - 1] == 0) {
+        --m;
+    }
+    return(m);
+}
+
+int aint::impl::limbsCmp(const singleComp* u, size_t m, const singleComp* v, size_t n) {
+    m = limbsSize(u, m);
+    n = limbsSize(v, n);
+    if (m != n) {
+        return(m < n ? -1 : 1);
+    }
+    for (size_t j = m; j-- > 0; ) {
+        if (u[j] != v[j]) {
+            return(u[j] < v[j] ? -1 : 1);
+        }
+    }
+    return(0);
+}
+
+aint::impl::singleComp aint::impl::limbsAdd(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n) {
+    // w may be identical to u (in-place addition)
+    singleComp carry = 0;
+    size_t j = 0;
+    for (; j < n; ++j) {
+        // promote the first operand to doubleComp
+        // to ensure doubleComp-arithmetic is used
+        doubleComp tmp = static_cast<doubleComp>(u[j]) + v[j] + carry;
+        carry = (tmp >= C_SINGLE_COMP_MAX_P1 ? 1 : 0);
+        w[j] = (carry ? tmp - C_SINGLE_COMP_MAX_P1 : tmp);
+    }
+    for (; carry && j < m; ++j) {
+        carry = (u[j] == C_SINGLE_COMP_MAX_P1 - 1 ? 1 : 0);
+        w[j] = (carry ? 0 : u[j] + 1);
+    }
+    if (w != u) {
+        std::copy(u + j, u + m, w + j);
+    }
+    return(carry);
+}
+
+aint::impl::singleComp aint::impl::limbsSub(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n) {
+    // w may be identical to u (in-place subtraction)
+    singleComp borrow = 0;
+    size_t j = 0;
+    for (; j < n; ++j) {
+        // promote the first operand to doubleComp
+        // to ensure doubleComp-arithmetic is used
+        doubleComp tmp = static_cast<doubleComp>(u[j]) - v[j] - borrow;
+        borrow = (tmp < 0 ? 1 : 0);
+        w[j] = (borrow ? tmp + C_SINGLE_COMP_MAX_P1 : tmp);
+    }
+    for (; borrow && j < m; ++j) {
+        borrow = (u[j] == 0 ? 1 : 0);
+        w[j] = (borrow ? C_SINGLE_COMP_MAX_P1 - 1 : u[j] - 1);
+    }
+    if (w != u) {
+        std::copy(u + j, u + m, w + j);
+    }
+    return(borrow);
+}
+
+aint::impl::singleComp aint::impl::limbsTimesSingle(singleComp* w, const singleComp* u, size_t m, const singleComp v) {
+    // w may be identical to u (in-place multiplication)
+    doubleComp carry = 0;
+    for (size_t j = 0; j < m; ++j) {
+        // promote the first operand to doubleComp
+        // to ensure doubleComp-arithmetic is used
+        doubleComp tmp = static_cast<doubleComp>(u[j]) * v + carry;
+        w[j]  = tmp % C_SINGLE_COMP_MAX_P1;
+        carry = tmp / C_SINGLE_COMP_MAX_P1;
+    }
+    return(carry);
+}
+
+aint::impl::singleComp aint::impl::limbsSubTimesSingle(singleComp* w, const singleComp* u, size_t m, const singleComp v) {
+    // the borrow is less than C_SINGLE_COMP_MAX_P1, since u[j] * v + borrow <= B^2 - B
+    doubleComp borrow = 0;
+    for (size_t j = 0; j < m; ++j) {
+        // promote the first operand to doubleComp
+        // to ensure doubleComp-arithmetic is used
+        doubleComp p   = static_cast<doubleComp>(u[j]) * v + borrow;
+        doubleComp tmp = w[j] - p % C_SINGLE_COMP_MAX_P1;
+        borrow = p / C_SINGLE_COMP_MAX_P1;
+        if (tmp < 0) {
+            tmp    += C_SINGLE_COMP_MAX_P1;
+            borrow += 1;
+        }
+        w[j] = tmp;
+    }
+    return(borrow);
+}
+
+unsigned long long int aint::impl::absLL(const long long int i) {
+    // -i overflows for the minimum of long long int, 0 - i in unsigned arithmetic does not
+    return(i < 0 ? 0ULL - static_cast<unsigned long long int>(i) : static_cast<unsigned long long int>(i));
+}
+
+size_t aint::impl::limbsULL(unsigned long long int i, singleComp* v) {
+    const unsigned long long int b = C_SINGLE_COMP_MAX_P1;
+    size_t n = 0;
+    do {
+        v[n++] = static_cast<singleComp>(i % b);
+        i /= b;
+    } while (i > 0);
+    return(n);
+}
+
+unsigned long long int aint::impl::limbsToULL(const singleComp* u, size_t m) {
+    const unsigned long long int b = C_SINGLE_COMP_MAX_P1;
+    unsigned long long int i = 0;
+    for (size_t j = m; j-- > 0; ) {
+        i = i * b + u[j];
+    }
+    return(i);
+}
+
+int aint::impl::operatorCmpAbsULL(const aint& lhs, const unsigned long long int rhs) const {
+    singleComp v[C_ULL_COMPS];
+    size_t n = limbsULL(rhs, v);
+    const data& u = lhs.pimpl()->data_;
+    return(limbsCmp(u.data(), u.size(), v, n));
+}
+
+void aint::impl::limbsToAint(const singleComp* u, size_t m, aint& a) {
+    data& d = a.pimpl()->data_;
+    m = limbsSize(u, m);
+    d.assign(u, u + m);
+    if (d.empty()) {
+        d.push_back(0);
+    }
+    a.pimpl()->positive_ = true;
+}
+
+void aint::impl::shiftComps(const aint& a, long k, aint& res) {
+    // res may be a: the components are moved within the same vector after it
+    // has been resized (to the top if k > 0, to the bottom if k < 0, shrinking
+    // does not touch the components)
+    bool positive = a.pimpl()->positive_;
+    const data& u = a.pimpl()->data_;
+    data& w = res.pimpl()->data_;
+    size_t m = u.size();
+    if (k >= 0) {
+        size_t s = static_cast<size_t>(k);
+        w.resizeUninitialised(m + s);
+        std::copy_backward(u.data(), u.data() + m, w.data() + m + s);
+        std::fill(w.data(), w.data() + s, 0);
+    } else if (static_cast<size_t>(-k) < m) {
+        size_t s = static_cast<size_t>(-k);
+        const singleComp* first = u.data() + s;
+        w.resizeUninitialised(m - s);
+        std::copy(first, first + (m - s), w.data());
+    } else {
+        w.resizeUninitialised(1);
+        w[0] = 0;
+    }
+    res.pimpl()->removeLeadingZeros();
+    res.pimpl()->positive_ = positive;
+    res.pimpl()->makeZeroPositive();
+}
+
 aint aint::impl::operatorPower(const aint& base, const aint& exp) const {
     // compute base^exp with "exponentiation by squaring"
     // see also http://en.wikipedia.org/wiki/Exponentiation_by_squaring
@@ -74,6 +231,143 @@ aint aint::impl::operatorPower(const aint& base, const aint& exp) const {
     }
 }
 
+aint aint::impl::operatorPowerModulo(const aint& base, const aint& exp, const aint& mod) const {
+    // compute base^exp % mod from left to right with a sliding window over the bits of exp, see
+    // A.Menezes, P.van Oorschot, S.Vanstone, Handbook of Applied Cryptography, 14.85; the products
+    // are reduced with Montgomery's multiplication if mod is coprime to B and with Barrett's
+    // reduction otherwise, so that all values have at most 2n single components for the n single
+    // components of mod
+    if (mod == 0) {
+        throw std::overflow_error("Divide by zero");
+    }
+    if (exp < 0) {
+        return(aint(0));
+    } else if (exp == 0) {
+        return(aint(1) % mod);
+    }
+    aint m(mod);
+    m.pimpl()->positive_ = true;
+    const data& v = m.pimpl()->data_;
+    size_t n = v.size();
+
+    // bits of exp (least significant first), k bits per division by 2^k < B
+    const data& e = exp.pimpl()->data_;
+    int k = 1;
+    while ((static_cast<doubleComp>(1) << (k + 1)) < C_SINGLE_COMP_MAX_P1) {
+        ++k;
+    }
+    scratchBuffer<singleComp> d(e.size());
+    std::copy(e.begin(), e.end(), d.data());
+    scratchBuffer<unsigned char> bits(e.size() * (k + 1) + k);
+    size_t t = 0;
+    for (size_t dn = d.size(); dn > 0; dn = limbsSize(d.data(), dn)) {
+        unsigned long long int r = limbsDivULL(d.data(), d.data(), dn, 1ULL << k);
+        for (int j = 0; j < k; ++j) {
+            bits[t++] = (r >> j) & 1;
+        }
+    }
+    while (bits[t - 1] == 0) {
+        --t;
+    }
+
+    // width of the window (up to 6 bits, a longer exponent needs a wider window)
+    const size_t windowBits[] = { 8, 24, 80, 240, 672 };
+    size_t w = 1;
+    while (w < 6 && t > windowBits[w - 1]) {
+        ++w;
+    }
+
+    // constants of mod: mi = -m^-1 mod B^n for Montgomery's multiplication, otherwise
+    // mu = floor(B^2n / m) for Barrett's reduction
+    aint mi;
+    aint mu;
+    bool montgomeryForm = montgomeryInverse(m, mi);
+    if (!montgomeryForm) {
+        shiftComps(aint(1), 2 * static_cast<long>(n), mu);
+        mu /= m;
+    }
+    scratchBuffer<singleComp> x(n, 0);
+    std::copy(mi.pimpl()->data_.begin(), mi.pimpl()->data_.end(), x.data());
+    scratchBuffer<singleComp> p(2 * n);
+    aint r;
+    // computes z = y1 * y2 (modulo m, in Montgomery form if montgomeryForm), z may be y1 or y2
+    auto times = [&](singleComp* z, const singleComp* y1, const singleComp* y2) {
+        if (montgomeryForm) {
+            montgomeryTimes(z, y1, y2, v.data(), n, x.data());
+        } else {
+            operatorTimesLimbs(p.data(), y1, n, y2, n);
+            limbsToAint(p.data(), 2 * n, r);
+            this->operatorModuloBarrett(r, m, mu, r);
+            std::fill(z, z + n, 0);
+            std::copy(r.pimpl()->data_.begin(), r.pimpl()->data_.end(), z);
+        }
+    };
+
+    // table[j] = abs(base)^(2j+1) for j < 2^(w-1), n single components each
+    aint b(base);
+    b.pimpl()->positive_ = true;
+    b %= m;
+    if (montgomeryForm) {
+        // Montgomery form of b = b * (B^2n % m) / B^n
+        aint s;
+        shiftComps(aint(1), 2 * static_cast<long>(n), s);
+        s %= m;
+        montgomeryTimes(b, s, m, mi, b);
+    }
+    size_t h = static_cast<size_t>(1) << (w - 1);
+    scratchBuffer<singleComp> table(h * n, 0);
+    std::copy(b.pimpl()->data_.begin(), b.pimpl()->data_.end(), table.data());
+    if (h > 1) {
+        scratchBuffer<singleComp> g(n);
+        times(g.data(), table.data(), table.data());
+        for (size_t j = 1; j < h; ++j) {
+            times(table.data() + j * n, table.data() + (j - 1) * n, g.data());
+        }
+    }
+
+    // a = abs(base)^exp: square for each bit, multiply for each window which starts and ends with a 1 bit
+    scratchBuffer<singleComp> a(n);
+    bool first = true;
+    long i = static_cast<long>(t) - 1;
+    while (i >= 0) {
+        if (bits[i] == 0) {
+            times(a.data(), a.data(), a.data());
+            --i;
+            continue;
+        }
+        long l = std::max(i - static_cast<long>(w) + 1, 0L);
+        while (bits[l] == 0) {
+            ++l;
+        }
+        size_t j = 0;
+        for (long s = i; s >= l; --s) {
+            j = 2 * j + bits[s];
+            if (!first) {
+                times(a.data(), a.data(), a.data());
+            }
+        }
+        if (first) {
+            std::copy(table.data() + j / 2 * n, table.data() + (j / 2 + 1) * n, a.data());
+            first = false;
+        } else {
+            times(a.data(), a.data(), table.data() + j / 2 * n);
+        }
+        i = l - 1;
+    }
+    if (montgomeryForm) {
+        // back from the Montgomery form: a = a * 1 / B^n
+        scratchBuffer<singleComp> one(n, 0);
+        one[0] = 1;
+        montgomeryTimes(a.data(), a.data(), one.data(), v.data(), n, x.data());
+    }
+    aint res;
+    limbsToAint(a.data(), n, res);
+    // the sign of power(exp) % mod is the sign of power(exp)
+    res.pimpl()->positive_ = base.pimpl()->positive_ || exp.even();
+    res.pimpl()->makeZeroPositive();
+    return(res);
+}
+
 aint aint::impl::operatorPowerTower(const aint& base, const aint& ord) const {
     // compute base^^ord, where ^^ is the double arrow operator
     // see also https://en.wikipedia.org/wiki/Knuth%27s_up-arrow_notation
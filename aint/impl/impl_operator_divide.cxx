@@ -24,9 +24,10 @@
  **************************************************************************/
 
 // arbitrary long integer
-// impl_operator_times.cxx (helper functions for operator times)
+// impl_operator_divide.cxx (helper functions for operator divide and operator modulo)
 
 #include "impl.hxx"
+#include <algorithm> // std::copy, std::min
 #include <iostream>
 
 namespace astd {
@@ -52,79 +53,199 @@ void aint::impl::operatorDivideSingle(const aint& lhs, const singleComp rhs, ain
     if (rhs == 0) {
         throw std::overflow_error("Divide by zero");
     }
+    // quot or rem may be lhs, since w[j] is written after u[j] is read (w is not zeroised)
     bool vPositive = (rhs < 0 ? false : true);
-    data& u = lhs.impl_->data_;
+    bool uPositive = lhs.pimpl()->positive_;
+    const data& u = lhs.pimpl()->data_;
     singleComp v = (vPositive ? rhs : (-rhs));
-    data& w = quot.impl_->data_;
-    data& e = rem.impl_->data_;
+    data& w = quot.pimpl()->data_;
+    data& e = rem.pimpl()->data_;
     size_t m = u.size();
-    quot.impl_->resizeAndZeroise(m);
+    w.resizeUninitialised(m);
     doubleComp carry = 0;
     for (int j = m - 1; j >= 0; --j) {
         doubleComp tmp = static_cast<doubleComp>(u[j]) + carry * C_SINGLE_COMP_MAX_P1;
         w[j]  = tmp / v;
         carry = tmp - static_cast<doubleComp>(w[j]) * v;
     }
-    quot.impl_->removeLeadingZeros();
-    quot.impl_->positive_ = (lhs.impl_->positive_ == vPositive ? true : false);
-    quot.impl_->makeZeroPositive();
+    quot.pimpl()->removeLeadingZeros();
+    quot.pimpl()->positive_ = (uPositive == vPositive ? true : false);
+    quot.pimpl()->makeZeroPositive();
+    e.resizeUninitialised(1);
     e[0] = carry;
-    rem.impl_->positive_ = lhs.impl_->positive_;
-    rem.impl_->makeZeroPositive();
+    rem.pimpl()->positive_ = uPositive;
+    rem.pimpl()->makeZeroPositive();
 }
 
-bool aint::impl::operatorDivideLessLeft(aint& lhs, const aint& rhs, const int p) {
-    // check if lhs < rhs by working on the (>= p) left components of lhs
-    data& u = lhs.impl_->data_;
-    data& v = rhs.impl_->data_;
-    size_t m = u.size() - p;
-    size_t n = v.size();
-    if (m < n) {
-        return(true);
-    }
-    if (n < m) {
-        return(false);
-    }
-    // m == n
-    for (int j = m - 1; j >= 0; --j) {
-        if (u[p + j] < v[j]) {
-            return(true);
+unsigned long long int aint::impl::limbsDivULL(singleComp* w, const singleComp* u, size_t m, const unsigned long long int v) {
+    // w may be identical to u or NULL (remainder only), the short division
+    // uses doubleComp arithmetic if v is a single component
+    if (v < static_cast<unsigned long long int>(C_SINGLE_COMP_MAX_P1)) {
+        const doubleComp d = static_cast<doubleComp>(v);
+        doubleComp r = 0;
+        for (size_t j = m; j-- > 0; ) {
+            doubleComp tmp = r * C_SINGLE_COMP_MAX_P1 + u[j];
+            if (w != NULL) {
+                w[j] = static_cast<singleComp>(tmp / d);
+            }
+            r = tmp % d;
         }
-        if (v[j] < u[p + j]) {
-            return(false);
+        return(static_cast<unsigned long long int>(r));
+    }
+#if defined(__SIZEOF_INT128__)
+    // r < v, so r * C_SINGLE_COMP_MAX_P1 + u[j] fits into 128 bits
+    unsigned __int128 r = 0;
+    for (size_t j = m; j-- > 0; ) {
+        unsigned __int128 tmp = r * static_cast<unsigned long long int>(C_SINGLE_COMP_MAX_P1) + static_cast<unsigned long long int>(u[j]);
+        if (w != NULL) {
+            w[j] = static_cast<singleComp>(tmp / v);
         }
+        r = tmp % v;
     }
-    return(false);
+    return(static_cast<unsigned long long int>(r));
+#else
+    // not used, see C_ULL_DIVISOR_MAX
+    return(0);
+#endif
 }
 
-void aint::impl::operatorDivideMinusLeft(aint& lhs, const aint& rhs, const int p) {
-    // compute lhs = lhs - rhs by working on the (>= p) left components of lhs
+void aint::impl::operatorDivideULL(const aint& lhs, const unsigned long long int rhs, const bool rhsPositive, aint& quot) const {
+    // compute quot = lhs / rhs, where rhs is a machine integer (quot may be lhs)
+    if (rhs == 0) {
+        throw std::overflow_error("Divide by zero");
+    }
+    if (rhs > C_ULL_DIVISOR_MAX) {
+        aint v(rhs);
+        v.pimpl()->positive_ = rhsPositive;
+        this->operatorDivide(lhs, v, &quot, NULL);
+        return;
+    }
+    bool positive = (lhs.pimpl()->positive_ == rhsPositive ? true : false);
+    const data& u = lhs.pimpl()->data_;
+    data& w = quot.pimpl()->data_;
+    size_t m = u.size();
+    w.resizeUninitialised(m);
+    limbsDivULL(w.data(), u.data(), m, rhs);
+    quot.pimpl()->removeLeadingZeros();
+    quot.pimpl()->positive_ = positive;
+    quot.pimpl()->makeZeroPositive();
+}
 
-    data& u = lhs.impl_->data_;
-    data& v = rhs.impl_->data_;
-    //size_t m = u.size();
-    size_t n = v.size();
+void aint::impl::operatorModuloULL(const aint& lhs, const unsigned long long int rhs, aint& rem) const {
+    // compute rem = lhs % rhs, where rhs is a machine integer (rem may be lhs)
+    if (rhs == 0) {
+        throw std::overflow_error("Divide by zero");
+    }
+    if (rhs > C_ULL_DIVISOR_MAX) {
+        aint v(rhs);
+        this->operatorDivide(lhs, v, NULL, &rem);
+        return;
+    }
+    bool positive = lhs.pimpl()->positive_;
+    const data& u = lhs.pimpl()->data_;
+    unsigned long long int r = limbsDivULL(NULL, u.data(), u.size(), rhs);
+    rem.pimpl()->ctorULL(r);
+    rem.pimpl()->positive_ = positive;
+    rem.pimpl()->makeZeroPositive();
+}
 
-    doubleComp borrow = 0;
-    for (int i = 0; i < n + 1; ++i) {
-        // promote the first operand to doubleComp
-        // to ensure doubleComp-arithmetic is used
-        doubleComp tmp = static_cast<doubleComp>(u[p + i]) - (i < n ? v[i] : 0) - borrow;
-        if (tmp < 0) {
-            // borrow from next element
-            borrow = 1;
-            tmp += C_SINGLE_COMP_MAX_P1;
-        } else {
-            borrow = 0;
+void aint::impl::operatorDivideULL(const unsigned long long int lhs, const bool lhsPositive, const aint& rhs, aint& quot, aint& rem) const {
+    // compute lhs = rhs * quot + rem, where lhs is a machine integer, so
+    // that abs(quot) and abs(rem) are machine integers as well
+    if (rhs == 0) {
+        throw std::overflow_error("Divide by zero");
+    }
+    bool positive = (lhsPositive == rhs.pimpl()->positive_ ? true : false);
+    unsigned long long int q = 0;
+    unsigned long long int r = lhs;
+    if (this->operatorCmpAbsULL(rhs, lhs) <= 0) {
+        const data& v = rhs.pimpl()->data_;
+        unsigned long long int d = limbsToULL(v.data(), v.size());
+        q = lhs / d;
+        r = lhs % d;
+    }
+    quot.pimpl()->ctorULL(q);
+    quot.pimpl()->positive_ = positive;
+    quot.pimpl()->makeZeroPositive();
+    rem.pimpl()->ctorULL(r);
+    rem.pimpl()->positive_ = lhsPositive;
+    rem.pimpl()->makeZeroPositive();
+}
+
+void aint::impl::operatorDivideBasecase(singleComp* q, singleComp* u, size_t m, const singleComp* v, size_t n) {
+    // use D.Knuth's algorithm D from TAoCP, Vol 2, 4.3.1 ([D1] and [D8] are done by the
+    // caller), v * q-hat is subtracted in place
+    const doubleComp b = C_SINGLE_COMP_MAX_P1;
+
+    // [D2] Initialise j
+    for (int j = m; j >= 0; --j) {
+        // [D3] Calculate q-hat from the two leading components of v, which makes
+        // q-hat at most one too large (and so in most cases correct)
+        doubleComp tmp = u[j + n] * b + u[j + n - 1];
+        doubleComp qh = tmp / v[n - 1];
+        doubleComp rh = tmp % v[n - 1];
+        while (qh >= b || qh * v[n - 2] > b * rh + u[j + n - 2]) {
+            qh -= 1;
+            rh += v[n - 1];
+            if (rh >= b) {
+                break;
+            }
+        }
+        // [D4] Multiply and subtract
+        doubleComp top = u[j + n] - limbsSubTimesSingle(u + j, v, n, static_cast<singleComp>(qh));
+        // [D5] Test remainder
+        if (top < 0) {
+            // [D6] Add back (the carry makes the top component zero again)
+            qh  -= 1;
+            top += limbsAdd(u + j, u + j, n, v, n);
         }
-        u[p + i] = tmp;
+        u[j + n] = top;
+        q[j] = qh;
     }
-    lhs.impl_->removeLeadingZeros();
+    // [D7] loop on j
 }
 
+void aint::impl::operatorDivideLimbs(singleComp* q, singleComp* u, size_t m, const singleComp* v, size_t n) {
+    size_t k = m + 1;
+    if (k < C_DIVIDE_BZ_THRESHOLD || n < C_DIVIDE_BZ_THRESHOLD) {
+        operatorDivideBasecase(q, u, m, v, n);
+    } else if (k < n) {
+        // the quotient of the 2k leading components of u and the k leading components
+        // of v is at most two too large (like q-hat in algorithm D), the remainder is
+        // corrected with the whole of v
+        size_t s = n - k;
+        scratchBuffer<singleComp> t(2 * k);
+        std::copy(u + s, u + m + n + 1, t.data());
+        operatorDivideLimbs(q, t.data(), m, v + s, k);
+        scratchBuffer<singleComp> p(m + n + 1);
+        operatorTimesLimbs(p.data(), q, k, v, n);
+        singleComp borrow = limbsSub(u, u, m + n + 1, p.data(), m + n + 1);
+        const singleComp one = 1;
+        while (borrow != 0) {
+            limbsSub(q, q, k, &one, 1);
+            borrow -= limbsAdd(u, u, m + n + 1, v, n);
+        }
+    } else if (k % n != 0) {
+        // divide the leading k % n components of the quotient first, so that the
+        // remaining ones fill whole blocks of n components
+        size_t s = k - k % n;
+        operatorDivideLimbs(q + s, u + s, k % n - 1, v, n);
+        operatorDivideLimbs(q, u, s - 1, v, n);
+    } else if (n >= C_DIVIDE_NEWTON_THRESHOLD && k >= 2 * n) {
+        // the reciprocal of v pays off if it is used for several blocks
+        operatorDivideNewton(q, u, m, v, n);
+    } else {
+        operatorDivideBZ(q, u, m, v, n);
+    }
+}
 
 void aint::impl::operatorDivide(const aint& lhs, const aint& rhs, aint& quot, aint& rem) const {
-    // compute lhs = rhs * quot + rem  (long division)
+    this->operatorDivide(lhs, rhs, &quot, &rem);
+}
+
+void aint::impl::operatorDivide(const aint& lhs, const aint& rhs, aint* quot, aint* rem) const {
+    // compute lhs = rhs * quot + rem  (long division), quot or rem may be lhs or rhs
+    // (e.g. for operator/=) or NULL, if only the other one is needed
 
     // check for division by zero
     if (rhs == 0) {
@@ -132,74 +253,112 @@ void aint::impl::operatorDivide(const aint& lhs, const aint& rhs, aint& quot, ai
     }
     // handle trivial case 1
     if (this->operatorLtAbs(lhs, rhs)) {
-        quot = 0;
-        rem = lhs;
+        if (rem != NULL) {
+            *rem = lhs;
+        }
+        if (quot != NULL) {
+            *quot = 0;
+        }
         return;
     }
     // handle trivial case 2
     if (lhs == rhs) {
-        quot = 1;
-        rem = 0;
+        if (quot != NULL) {
+            *quot = 1;
+        }
+        if (rem != NULL) {
+            *rem = 0;
+        }
         return;
     }
-    // handle short division
-    data& v0 = rhs.impl_->data_;
+    // handle short division (the kernels for machine integers allow a result to be lhs)
+    const data& v0 = rhs.pimpl()->data_;
     size_t n = v0.size();
+    bool uPositive = lhs.pimpl()->positive_;
+    bool vPositive = rhs.pimpl()->positive_;
     if (n == 1) {
-        this->operatorDivideSingle(lhs, (rhs.impl_->positive_ ? v0[0] : -v0[0]), quot, rem);
+        if (quot == NULL) {
+            this->operatorModuloULL(lhs, v0[0], *rem);
+        } else if (rem == NULL) {
+            this->operatorDivideULL(lhs, v0[0], vPositive, *quot);
+        } else {
+            this->operatorDivideSingle(lhs, (vPositive ? v0[0] : -v0[0]), *quot, *rem);
+        }
         return;
     }
 
-    // use D.Knuth's algorithm D from TAoCP, Vol 2, 4.3.1;
-    data& u0 = lhs.impl_->data_;
-    data&  q = quot.impl_->data_;
+    // [D1] Normalise u and v, so that the leading component of v is at least B / 2
+    // (see Early errata for Volume 2 (3rd ed.)), the normalised operands and the
+    // quotient are kept in the scratch arena, so that lhs and rhs are read before
+    // quot and rem are written (which may be lhs or rhs)
+    const data& u0 = lhs.pimpl()->data_;
     size_t m = u0.size() - n;
-    quot.impl_->resizeAndZeroise(m + 1);
-    rem.impl_->resizeAndZeroise(n);
+    singleComp d = C_SINGLE_COMP_MAX_P1 / (v0[n - 1] + 1);
+    scratchBuffer<singleComp> u(m + n + 1);
+    scratchBuffer<singleComp> v(n);
+    scratchBuffer<singleComp> q(m + 1);
+    u[m + n] = limbsTimesSingle(u.data(), u0.data(), m + n, d);
+    limbsTimesSingle(v.data(), v0.data(), n, d);
 
-    // [D1] Normalise
-    singleComp b = C_SINGLE_COMP_MAX_P1;
-    singleComp d = b / (v0[n - 1] + 1); // see Early errata for Volume 2 (3rd ed.)
-    aint lhsd = lhs * d;
-    aint rhsd = rhs * d;
-    data& u = lhsd.impl_->data_;
-    data& v = rhsd.impl_->data_;
+    // [D2] - [D7] with algorithm D or with one of the faster divisions for long operands
+    operatorDivideLimbs(q.data(), u.data(), m, v.data(), n);
 
-    // [D2] Initialise j
-    for (int j = m; j >= 0; --j) {
-        // [D3] Calculate q-hat
-        // promote the first operand to doubleComp to ensure doubleComp-arithmetic is used
-        doubleComp tmp = static_cast<doubleComp>(u[j + n]) * b + u[j + n - 1];
-        doubleComp qh = tmp / v[n - 1];
-        doubleComp rh = tmp % v[n - 1];
-        if ( qh >= b // see Early errata for Volume 2 (3rd ed.)
-             || qh * v[n - 2] > b * rh + u[j + n - 2]) {
-            qh -= 1;
-            rh += v[n - 1];
-        }
-        // [D5] Test remainer
-        if (lhsd.impl_->operatorDivideLessLeft(lhsd, rhsd * qh, j)) {
-            // [D6] Add back
-            qh -= 1;
-        }
-        // [D4] Multiply and subtract
-        lhsd.impl_->operatorDivideMinusLeft(lhsd, rhsd * qh, j);
-        q[j] = qh;
+    // finalise quotient (limbsToAint keeps the capacity of quot)
+    if (quot != NULL) {
+        limbsToAint(q.data(), m + 1, *quot);
+        quot->pimpl()->positive_ = (uPositive == vPositive ? true : false);
+        quot->pimpl()->makeZeroPositive();
     }
-    // [D7] loop on j
 
-    // [D8] Unnormalise
-    rem = lhsd / d;
+    // [D8] Unnormalise the remainder and finalise it
+    if (rem != NULL) {
+        limbsDivULL(u.data(), u.data(), n, d);
+        limbsToAint(u.data(), n, *rem);
+        rem->pimpl()->positive_ = uPositive;
+        rem->pimpl()->makeZeroPositive();
+    }
+}
 
-    // finalise reminder
-    rem.impl_->removeLeadingZeros();
-    rem.impl_->positive_ = lhs.impl_->positive_;
-    rem.impl_->makeZeroPositive();
+void aint::impl::operatorModuloBarrett(const aint& lhs, const aint& mod, const aint& mu, aint& rem) const {
+    // Barrett's reduction, see A.Menezes, P.van Oorschot, S.Vanstone, Handbook of Applied
+    // Cryptography, 14.42
+    const data& u = lhs.pimpl()->data_;
+    const data& v = mod.pimpl()->data_;
+    const data& x = mu.pimpl()->data_;
+    size_t m = u.size();
+    size_t n = v.size();
+    if (m > 2 * n) {
+        // beyond the precision of mu
+        this->operatorDivide(lhs, mod, NULL, &rem);
+        return;
+    }
+    if (m < n) {
+        // abs(lhs) < B^(n-1) <= abs(mod)
+        if (&rem != &lhs) {
+            rem = lhs;
+        }
+        return;
+    }
+    bool positive = lhs.pimpl()->positive_;
 
-    // finalise quotient
-    quot.impl_->removeLeadingZeros();
-    quot.impl_->positive_ = (lhs.impl_->positive_ == rhs.impl_->positive_ ? true : false);
-    quot.impl_->makeZeroPositive();
+    // q = floor(floor(u / B^(n-1)) * mu / B^(n+1)) is at most two too small, so
+    // that r = u - q * v < 3 * v is computed modulo B^(n+1)
+    size_t k = m - n + 1;
+    size_t l = x.size();
+    scratchBuffer<singleComp> p(k + l);
+    operatorTimesLimbs(p.data(), u.data() + n - 1, k, x.data(), l);
+    size_t qn = k + l - n - 1;
+    scratchBuffer<singleComp> t(qn + n);
+    operatorTimesLimbs(t.data(), p.data() + n + 1, qn, v.data(), n);
+    scratchBuffer<singleComp> r(n + 1, 0);
+    std::copy(u.data(), u.data() + std::min(m, n + 1), r.data());
+    limbsSub(r.data(), r.data(), n + 1, t.data(), std::min(qn + n, n + 1));
+    while (limbsCmp(r.data(), n + 1, v.data(), n) >= 0) {
+        limbsSub(r.data(), r.data(), n + 1, v.data(), n);
+    }
+    limbsToAint(r.data(), n + 1, rem);
+    rem.pimpl()->positive_ = positive;
+    rem.pimpl()->makeZeroPositive();
 }
 
 } // end of namespace astd
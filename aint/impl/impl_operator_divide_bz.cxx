@@ -0,0 +1,101 @@
+/*
+ *  This file is part of aint.
+ *
+ *  aint provides a C++ class for arbitrary long integers which can be
+ *  used the same way as the C/C++ integer types (e.g. int or long),
+ *  but has no restriction on the length (if there is enough memory).
+ *  Aim of this project is to include fast integer multiplications
+ *  like the Toom-Cook algorithm or the Schoenhage-Strassen algorithm.
+ *  Copyright (C) 2014 Mario Baumann (mario-baumann@web.de)
+ *
+ *  aint is free software: you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  aint is distributed in the hope that it will be useful, but
+ *  WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with aint.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************/
+
+// arbitrary long integer
+// impl_operator_divide_bz.cxx (recursive division of Burnikel and Ziegler)
+
+#include "impl.hxx"
+#include <algorithm> // std::copy, std::fill
+
+namespace astd {
+
+//
+// C.Burnikel, J.Ziegler, Fast Recursive Division, MPI-I-98-1-022 (1998): a division
+// of 2n by n components is split into two divisions of 3h by 2h components (h = n / 2),
+// each of them into a division of 2h by h components and a product of h by h components,
+// so that the division is about twice as expensive as the product
+//
+
+void aint::impl::operatorDivideBZ(singleComp* q, singleComp* u, size_t m, const singleComp* v, size_t n) {
+    // pad v with p zeros at the bottom to b = j * 2^s components, where j is less than
+    // C_DIVIDE_BZ_THRESHOLD, so that bzDivide21 halves b down to the basecase division
+    size_t s = 0;
+    while (((n - 1) >> s) + 1 >= C_DIVIDE_BZ_THRESHOLD) {
+        ++s;
+    }
+    size_t b = (((n - 1) >> s) + 1) << s;
+    size_t p = b - n;
+    scratchBuffer<singleComp> w(b, 0);
+    std::copy(v, v + n, w.data() + p);
+
+    // pad u likewise and with zeros to t + 1 blocks of b components at the top, the
+    // leading block is less than w, and divide block by block (from the top)
+    size_t t = (m + b) / b;
+    scratchBuffer<singleComp> a((t + 1) * b, 0);
+    scratchBuffer<singleComp> c(t * b);
+    std::copy(u, u + m + n + 1, a.data() + p);
+    for (size_t i = t; i-- > 0; ) {
+        bzDivide21(c.data() + i * b, a.data() + i * b, w.data(), b);
+    }
+    std::copy(c.data(), c.data() + m + 1, q);
+    std::copy(a.data() + p, a.data() + p + n, u);
+}
+
+void aint::impl::bzDivide21(singleComp* q, singleComp* a, const singleComp* v, size_t n) {
+    if (n % 2 != 0 || n < C_DIVIDE_BZ_THRESHOLD) {
+        operatorDivideBasecase(q, a, n - 1, v, n);
+        return;
+    }
+    // a = [a1, a2, a3, a4] with components of h single components
+    size_t h = n / 2;
+    bzDivide32(q + h, a + h, v, h);
+    bzDivide32(q, a, v, h);
+}
+
+void aint::impl::bzDivide32(singleComp* q, singleComp* a, const singleComp* v, size_t h) {
+    // a = [a1, a2, a3] and v = [v1, v2] with components of h single components: the
+    // estimate q-hat = floor([a1, a2] / v1) (or B^h - 1, if a1 == v1) is at most two
+    // too large, [a1, a2] - q-hat * v1 is kept in r = a[h..3h)
+    singleComp* r = a + h;
+    if (limbsCmp(a + 2 * h, h, v + h, h) < 0) {
+        bzDivide21(q, r, v + h, h);
+    } else {
+        // [a1, a2] - (B^h - 1) * v1 = [a1 - v1, a2] + v1, where a1 - v1 = 0
+        std::fill(q, q + h, C_SINGLE_COMP_MAX_P1 - 1);
+        limbsSub(a + 2 * h, a + 2 * h, h, v + h, h);
+        limbsAdd(r, r, 2 * h, v + h, h);
+    }
+    // subtract q-hat * v2 from [r, a3] and add v while the difference is negative
+    scratchBuffer<singleComp> d(2 * h);
+    operatorTimesLimbs(d.data(), q, h, v, h);
+    singleComp borrow = limbsSub(a, a, 3 * h, d.data(), 2 * h);
+    const singleComp one = 1;
+    while (borrow != 0) {
+        limbsSub(q, q, h, &one, 1);
+        borrow -= limbsAdd(a, a, 3 * h, v, 2 * h);
+    }
+}
+
+} // end of namespace astd
@@ -0,0 +1,120 @@
+/*
+ *  This file is part of aint.
+ *
+ *  aint provides a C++ class for arbitrary long integers which can be
+ *  used the same way as the C/C++ integer types (e.g. int or long),
+ *  but has no restriction on the length (if there is enough memory).
+ *  Aim of this project is to include fast integer multiplications
+ *  like the Toom-Cook algorithm or the Schoenhage-Strassen algorithm.
+ *  Copyright (C) 2014 Mario Baumann (mario-baumann@web.de)
+ *
+ *  aint is free software: you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  aint is distributed in the hope that it will be useful, but
+ *  WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with aint.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************/
+
+// arbitrary long integer
+// impl_operator_divide_newton.cxx (division with Newton's reciprocal)
+
+#include "impl.hxx"
+#include <algorithm> // std::copy
+
+namespace astd {
+
+void aint::impl::operatorDivideReciprocal(const singleComp* v, size_t n, aint& x, aint& r) {
+    // compute x = floor(B^2n / v) and r = B^2n - v * x, where B^n <= x <= 2 * B^n,
+    // since v is normalised, see also R.Brent, P.Zimmermann, Modern Computer
+    // Arithmetic, 3.4.1
+    if (n < C_DIVIDE_NEWTON_THRESHOLD) {
+        // divide B^2n by v with algorithm D or the recursive division
+        scratchBuffer<singleComp> u(2 * n + 2, 0);
+        scratchBuffer<singleComp> q(n + 2);
+        u[2 * n] = 1;
+        operatorDivideLimbs(q.data(), u.data(), n + 1, v, n);
+        limbsToAint(q.data(), n + 2, x);
+        limbsToAint(u.data(), n, r);
+        return;
+    }
+    // with v = vh * B^l + vl the reciprocal xh = floor(B^2h / vh) of the h leading
+    // components gives x0 = xh * B^l with about h correct components, one step
+    //
+    //   x = x0 + x0 * (B^2n - v * x0) / B^2n
+    //
+    // of Newton's iteration for 1 / v doubles them
+    size_t l = n / 2;
+    size_t h = n - l;
+    aint xh, rh;
+    operatorDivideReciprocal(v + l, h, xh, rh);
+    aint vl, vn;
+    limbsToAint(v, l, vl);
+    limbsToAint(v, n, vn);
+    // e = (B^2n - v * x0) / B^l = rh * B^l - vl * xh (which may be negative)
+    aint e;
+    shiftComps(rh, l, e);
+    e -= vl * xh;
+    // x = x0 + xh * e / B^2h and r = B^2n - v * x = e * B^l - v * (x - x0)
+    aint dx;
+    shiftComps(xh * e, -2 * static_cast<long>(h), dx);
+    shiftComps(xh, l, x);
+    x += dx;
+    shiftComps(e, l, r);
+    r -= vn * dx;
+    // the truncations (and the error of x0) leave x a few units off
+    while (r < 0) {
+        x -= 1;
+        r += vn;
+    }
+    while (r >= vn) {
+        x += 1;
+        r -= vn;
+    }
+}
+
+void aint::impl::operatorDivideNewton(singleComp* q, singleComp* u, size_t m, const singleComp* v, size_t n) {
+    // divide u block by block (n components each, from the top) by v: with the leading
+    // n components a1 of a block a < v * B^n the estimate
+    //
+    //   q0 = floor(floor(a / B^(n-1)) * x / B^(n+1)), where x = floor(B^2n / v)
+    //
+    // is at most two units too small, so that at most two subtractions of v correct it
+    aint x, r;
+    operatorDivideReciprocal(v, n, x, r);
+    scratchBuffer<singleComp> xs(n + 1, 0);
+    const data& xd = x.pimpl()->data_;
+    std::copy(xd.data(), xd.data() + xd.size(), xs.data());
+
+    // pad u with zeros to t + 1 blocks, the leading block is less than v
+    size_t t = (m + n) / n;
+    scratchBuffer<singleComp> a((t + 1) * n, 0);
+    scratchBuffer<singleComp> b(t * n);
+    std::copy(u, u + m + n + 1, a.data());
+    scratchBuffer<singleComp> p(2 * n + 2);
+    scratchBuffer<singleComp> s(2 * n);
+    const singleComp one = 1;
+    for (size_t i = t; i-- > 0; ) {
+        singleComp* ai = a.data() + i * n;
+        singleComp* qi = b.data() + i * n;
+        operatorTimesLimbs(p.data(), ai + n - 1, n + 1, xs.data(), n + 1);
+        std::copy(p.data() + n + 1, p.data() + 2 * n + 1, qi);
+        operatorTimesLimbs(s.data(), qi, n, v, n);
+        limbsSub(ai, ai, 2 * n, s.data(), 2 * n);
+        while (limbsCmp(ai, n + 1, v, n) >= 0) {
+            limbsSub(ai, ai, n + 1, v, n);
+            limbsAdd(qi, qi, n, &one, 1);
+        }
+    }
+    std::copy(b.data(), b.data() + m + 1, q);
+    std::copy(a.data(), a.data() + n, u);
+}
+
+} // end of namespace astd
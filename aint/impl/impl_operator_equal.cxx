@@ -35,31 +35,33 @@ bool aint::impl::operatorEqLL(const aint& lhs, const long long int rhs) const {
 
     // try to avoid the generic operator call
     if (rhs >= 0) {
-        if (!lhs.impl_->positive_) {
+        if (!lhs.pimpl()->positive_) {
             return(false);
-        } else if (lhs.impl_->data_.size() == 1) {
-            return(lhs.impl_->data_[0] == rhs ? true : false);
+        } else if (lhs.pimpl()->data_.size() == 1) {
+            return(lhs.pimpl()->data_[0] == rhs ? true : false);
         }
     } else {
-        if (lhs.impl_->positive_) {
+        if (lhs.pimpl()->positive_) {
             return(false);
-        } else if (lhs.impl_->data_.size() == 1) {
-            return(lhs.impl_->data_[0] == (-rhs) ? true : false);
+        } else if (lhs.pimpl()->data_.size() == 1) {
+            return(static_cast<unsigned long long int>(lhs.pimpl()->data_[0]) == absLL(rhs) ? true : false);
         }
     }
-    return(lhs.operator==(aint(rhs)));
+    // compare the absolute values without allocating an aint
+    return(this->operatorCmpAbsULL(lhs, absLL(rhs)) == 0);
 }
 
 bool aint::impl::operatorEqULL(const aint& lhs, const unsigned long long int rhs) const {
     // checks if lhs == rhs
 
     // try to avoid the generic operator call
-    if (!lhs.impl_->positive_) {
+    if (!lhs.pimpl()->positive_) {
         return(false);
-    } else if (lhs.impl_->data_.size() == 1) {
-        return(lhs.impl_->data_[0] == rhs ? true : false);
+    } else if (lhs.pimpl()->data_.size() == 1) {
+        return(static_cast<unsigned long long int>(lhs.pimpl()->data_[0]) == rhs ? true : false);
     }
-    return(lhs.operator==(aint(rhs)));
+    // compare the absolute values without allocating an aint
+    return(this->operatorCmpAbsULL(lhs, rhs) == 0);
 }
 
 } // end of namespace astd
@@ -35,37 +35,40 @@ bool aint::impl::operatorLtLL(const aint& lhs, const long long int rhs) const {
 
     // try to avoid the generic operator call
     if (rhs > 0) {
-        if (!lhs.impl_->positive_) {
+        if (!lhs.pimpl()->positive_) {
             return(true);
-        } else if (lhs.impl_->data_.size() == 1) {
-            return(lhs.impl_->data_[0] < rhs ? true : false);
+        } else if (lhs.pimpl()->data_.size() == 1) {
+            return(lhs.pimpl()->data_[0] < rhs ? true : false);
         }
     } else {
-        if (lhs.impl_->positive_) {
+        if (lhs.pimpl()->positive_) {
             return(false);
-        } else if (lhs.impl_->data_.size() == 1) {
-            return(lhs.impl_->data_[0] <= (-rhs) ? false : true);
+        } else if (lhs.pimpl()->data_.size() == 1) {
+            return(static_cast<unsigned long long int>(lhs.pimpl()->data_[0]) <= absLL(rhs) ? false : true);
         }
     }
-    return(lhs.operator<(aint(rhs)));
+    // lhs and rhs have the same sign (compare the absolute values without allocating an aint)
+    int cmp = this->operatorCmpAbsULL(lhs, absLL(rhs));
+    return(lhs.pimpl()->positive_ ? cmp < 0 : cmp > 0);
 }
 
 bool aint::impl::operatorLtULL(const aint& lhs, const unsigned long long int rhs) const {
     // checks if lhs < rhs
 
     // try to avoid the generic operator call
-    if (!lhs.impl_->positive_) {
+    if (!lhs.pimpl()->positive_) {
         return(true);
-    } else if (lhs.impl_->data_.size() == 1) {
-        return(lhs.impl_->data_[0] < rhs ? true : false);
+    } else if (lhs.pimpl()->data_.size() == 1) {
+        return(static_cast<unsigned long long int>(lhs.pimpl()->data_[0]) < rhs ? true : false);
     }
-    return(lhs.operator<(aint(rhs)));
+    // compare the absolute values without allocating an aint
+    return(this->operatorCmpAbsULL(lhs, rhs) < 0);
 }
 
 bool aint::impl::operatorLtAbs(const aint& lhs, const aint& rhs) const {
     // checks if abs(lhs) < abs(rhs)
-    size_t LS = lhs.impl_->data_.size();
-    size_t RS = rhs.impl_->data_.size();
+    size_t LS = lhs.pimpl()->data_.size();
+    size_t RS = rhs.pimpl()->data_.size();
     if (LS < RS) {
         return(true);
     }
@@ -74,10 +77,10 @@ bool aint::impl::operatorLtAbs(const aint& lhs, const aint& rhs) const {
     }
     // LS == RS
     for (int j = LS - 1; j >= 0; --j) {
-        if (lhs.impl_->data_[j] < rhs.impl_->data_[j]) {
+        if (lhs.pimpl()->data_[j] < rhs.pimpl()->data_[j]) {
             return(true);
         }
-        if (rhs.impl_->data_[j] < lhs.impl_->data_[j]) {
+        if (rhs.pimpl()->data_[j] < lhs.pimpl()->data_[j]) {
             return(false);
         }
     }
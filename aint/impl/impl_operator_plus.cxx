@@ -27,17 +27,19 @@
 // impl_operator_plus.cxx (helper functions for operator plus and opeator minus)
 
 #include "impl.hxx"
+#include <algorithm> // std::max
 
 namespace astd {
 
 void aint::impl::operatorPlusAdd(const aint& lhs, const aint& rhs, aint& res) const {
-    // compute res = lhs + rhs, where abs(rhs) <= abs(lhs)
-    data& u = lhs.impl_->data_;
-    data& v = rhs.impl_->data_;
-    data& w = res.impl_->data_;
+    // compute res = lhs + rhs, where abs(rhs) <= abs(lhs); res may be lhs or rhs,
+    // since w[j] is written after u[j] and v[j] are read (w is not zeroised)
+    const data& u = lhs.pimpl()->data_;
+    const data& v = rhs.pimpl()->data_;
+    data& w = res.pimpl()->data_;
     size_t m = u.size();
     size_t n = v.size();
-    res.impl_->resizeAndZeroise(m + 1);
+    w.resizeUninitialised(m + 1);
     doubleComp carry = 0;
     for (int j = 0; j < m; ++j) {
         // promote the first operand to doubleComp
@@ -46,20 +48,18 @@ void aint::impl::operatorPlusAdd(const aint& lhs, const aint& rhs, aint& res) co
         w[j]  = tmp % C_SINGLE_COMP_MAX_P1;
         carry = tmp / C_SINGLE_COMP_MAX_P1;
     }
-    if (carry) {
-        w[m] = carry;
-    }
-    res.impl_->removeLeadingZeros();
+    w[m] = carry;
+    res.pimpl()->removeLeadingZeros();
 }
 
 void aint::impl::operatorPlusSub(const aint& lhs, const aint& rhs, aint& res) const {
-    // compute res = lhs - rhs, where abs(rhs) <= abs(lhs)
-    data& u = lhs.impl_->data_;
-    data& v = rhs.impl_->data_;
-    data& w = res.impl_->data_;
+    // compute res = lhs - rhs, where abs(rhs) <= abs(lhs); res may be lhs or rhs (see above)
+    const data& u = lhs.pimpl()->data_;
+    const data& v = rhs.pimpl()->data_;
+    data& w = res.pimpl()->data_;
     size_t m = u.size();
     size_t n = v.size();
-    res.impl_->resizeAndZeroise(m);
+    w.resizeUninitialised(m);
     doubleComp borrow = 0;
     for (int j = 0; j < m; ++j) {
         // promote the first operand to doubleComp
@@ -74,13 +74,41 @@ void aint::impl::operatorPlusSub(const aint& lhs, const aint& rhs, aint& res) co
         }
         w[j] = tmp;
     }
-    res.impl_->removeLeadingZeros();
+    res.pimpl()->removeLeadingZeros();
+}
+
+void aint::impl::operatorPlusULL(const aint& lhs, const unsigned long long int rhs, const bool rhsPositive, aint& res) const {
+    // compute res = lhs + rhs, where rhs is a machine integer (res may be lhs)
+    singleComp v[C_ULL_COMPS];
+    size_t n = limbsULL(rhs, v);
+    const data& u = lhs.pimpl()->data_;
+    data& w = res.pimpl()->data_;
+    size_t m = u.size();
+    bool positive = lhs.pimpl()->positive_;
+    if (positive == rhsPositive || rhs == 0) {
+        // abs(res) = abs(lhs) + rhs (w is resized before the pointers are taken)
+        size_t k = std::max(m, n);
+        w.resizeUninitialised(k + 1);
+        w[k] = (m >= n ? limbsAdd(w.data(), u.data(), m, v, n) : limbsAdd(w.data(), v, n, u.data(), m));
+    } else if (limbsCmp(u.data(), m, v, n) >= 0) {
+        // abs(res) = abs(lhs) - rhs
+        w.resizeUninitialised(m);
+        limbsSub(w.data(), u.data(), m, v, n);
+    } else {
+        // abs(res) = rhs - abs(lhs), where m <= n
+        w.resizeUninitialised(n);
+        limbsSub(w.data(), v, n, u.data(), m);
+        positive = rhsPositive;
+    }
+    res.pimpl()->removeLeadingZeros();
+    res.pimpl()->positive_ = positive;
+    res.pimpl()->makeZeroPositive();
 }
 
 bool aint::impl::operatorPlusChk(const aint& lhs, const aint& rhs) const {
     // if abs(rhs) <= abs(lhs) then return true, otherwise return false
-    size_t m = lhs.impl_->data_.size();
-    size_t n = rhs.impl_->data_.size();
+    size_t m = lhs.pimpl()->data_.size();
+    size_t n = rhs.pimpl()->data_.size();
     if (n < m) {
         return(true);
     } else if (m < n) {
@@ -141,20 +169,20 @@ void aint::impl::operatorPlus(const aint& lhs, const aint& rhs, aint& res, bool
         // |                            +-----------------<--------------------+   |
         // +---------------------------------------------<-------------------------+
     };
-    int sL = (lhs.impl_->positive_ ? 0 : 1); // sign of lhs (1 if negative, 0 otherwise)
-    int sR = (rhs.impl_->positive_ ? 0 : 1); // likewise for rhs
+    int sL = (lhs.pimpl()->positive_ ? 0 : 1); // sign of lhs (1 if negative, 0 otherwise)
+    int sR = (rhs.pimpl()->positive_ ? 0 : 1); // likewise for rhs
     bool LgeR = operatorPlusChk(lhs, rhs);
     int sS = (!LgeR ? 1 : 0 );
     int id = 2 * (2 * sL + sR) + sS + (minusSwitch ? 8 : 0);
     const struct entry* e = &table[id];
     if (e->lhs_rhs) {
-        ((*res.impl_).*(e->helper))(lhs, rhs, res);
+        ((*res.pimpl()).*(e->helper))(lhs, rhs, res);
     } else {
-        ((*res.impl_).*(e->helper))(rhs, lhs, res);
+        ((*res.pimpl()).*(e->helper))(rhs, lhs, res);
     }
-    res.impl_->positive_ = e->res_positive;
+    res.pimpl()->positive_ = e->res_positive;
     // make sure 0 has positive sign
-    res.impl_->makeZeroPositive();
+    res.pimpl()->makeZeroPositive();
 }
 
 } // end of namespace astd
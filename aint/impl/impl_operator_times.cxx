@@ -27,61 +27,284 @@
 // impl_operator_times.cxx (helper functions for operator times)
 
 #include "impl.hxx"
+#include <algorithm> // std::copy, std::fill, std::swap, std::min
 #include <iostream>
 
 namespace astd {
 
 void aint::impl::operatorTimesSingle( const aint& lhs, const singleComp rhs, aint& res) const {
-    // compute res = lhs * rhs (where rhs is a singleComp)
+    // compute res = lhs * rhs (where rhs is a singleComp); res may be lhs,
+    // since w[i] is written after u[i] is read (w is not zeroised)
     bool vPositive = (rhs < 0 ? false : true);
-    data& u = lhs.impl_->data_;
+    bool uPositive = lhs.pimpl()->positive_;
+    const data& u = lhs.pimpl()->data_;
     singleComp v = (vPositive ? rhs : (-rhs));
-    data& w = res.impl_->data_;
+    data& w = res.pimpl()->data_;
     size_t m = u.size();
-    res.impl_->resizeAndZeroise(m + 1);
-    doubleComp carry = 0;
-    for (int i = 0; i < m; ++i) {
-        // promote the first operand to doubleComp
-        // to ensure doubleComp-arithmetic is used
-        doubleComp tmp = static_cast<doubleComp>(u[i]) * v + carry;
-        w[i]  = tmp % C_SINGLE_COMP_MAX_P1;
-        carry = tmp / C_SINGLE_COMP_MAX_P1;
-    }
-    w[m] = carry;
-    res.impl_->removeLeadingZeros();
+    w.resizeUninitialised(m + 1);
+    w[m] = limbsTimesSingle(w.data(), u.data(), m, v);
+    res.pimpl()->removeLeadingZeros();
     // set sign of result
-    res.impl_->positive_ = (lhs.impl_->positive_ == vPositive ? true : false);
+    res.pimpl()->positive_ = (uPositive == vPositive ? true : false);
+    res.pimpl()->makeZeroPositive();
+}
+
+void aint::impl::operatorTimesULL(const aint& lhs, const unsigned long long int rhs, const bool rhsPositive, aint& res) const {
+    // compute res = lhs * rhs, where rhs is a machine integer (res may be lhs)
+    if (rhs < static_cast<unsigned long long int>(C_SINGLE_COMP_MAX_P1)) {
+        singleComp v = static_cast<singleComp>(rhs);
+        this->operatorTimesSingle(lhs, (rhsPositive ? v : -v), res);
+        return;
+    }
+    singleComp v[C_ULL_COMPS];
+    size_t n = limbsULL(rhs, v);
+    bool positive = (lhs.pimpl()->positive_ == rhsPositive ? true : false);
+    data& w = res.pimpl()->data_;
+    size_t m = lhs.pimpl()->data_.size();
+    w.reserve(m + n);
+    if (&res != &lhs) {
+        w.assign(lhs.pimpl()->data_.begin(), lhs.pimpl()->data_.end());
+    }
+    w.resize(m + n);
+    // multiply in place from the most significant component downwards: w[i] is
+    // replaced by w[i] * v, the components above i already hold the product of
+    // the higher components of lhs (and take the carries), the ones below i are
+    // still the components of lhs
+    for (size_t i = m; i-- > 0; ) {
+        doubleComp x = w[i];
+        doubleComp carry = 0;
+        w[i] = 0;
+        size_t j = 0;
+        for (; j < n; ++j) {
+            doubleComp tmp = x * v[j] + w[i + j] + carry;
+            w[i + j] = tmp % C_SINGLE_COMP_MAX_P1;
+            carry    = tmp / C_SINGLE_COMP_MAX_P1;
+        }
+        for (j += i; carry; ++j) {
+            doubleComp tmp = w[j] + carry;
+            w[j]  = tmp % C_SINGLE_COMP_MAX_P1;
+            carry = tmp / C_SINGLE_COMP_MAX_P1;
+        }
+    }
+    res.pimpl()->removeLeadingZeros();
+    res.pimpl()->positive_ = positive;
+    res.pimpl()->makeZeroPositive();
+}
+
+void aint::impl::operatorTimesBasecase(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n) {
+    // compute the product column by column (Comba's method), i.e. w[k] is the sum of all
+    // u[i] * v[k - i] plus the carry of column k - 1; the partial products are summed up in
+    // a productComp and reduced only after C_TIMES_COMBA_GROUP products
+    // (instead of a division and a modulo operation for each partial product)
+    const productComp B = C_SINGLE_COMP_MAX_P1;
+    productComp carry = 0;
+    for (size_t k = 0; k + 1 < m + n; ++k) {
+        size_t i    = (k < n ? 0 : k - n + 1);
+        size_t iEnd = (k < m ? k + 1 : m);
+        productComp acc  = carry % B;
+        productComp high = carry / B;
+        while (i < iEnd) {
+            size_t gEnd = std::min(iEnd, i + C_TIMES_COMBA_GROUP);
+            for (; i < gEnd; ++i) {
+                acc += static_cast<productComp>(u[i]) * static_cast<productComp>(v[k - i]);
+            }
+            high += acc / B;
+            acc  %= B;
+        }
+        w[k]  = static_cast<singleComp>(acc);
+        carry = high;
+    }
+    w[m + n - 1] = static_cast<singleComp>(carry);
+}
+
+void aint::impl::operatorSquareBasecase(singleComp* w, const singleComp* u, size_t m) {
+    // compute the square column by column (see operatorTimesBasecase), where the partial
+    // products u[i] * u[j] with i < j are summed up once and doubled
+    const productComp B = C_SINGLE_COMP_MAX_P1;
+    productComp carry = 0;
+    for (size_t k = 0; k + 1 < 2 * m; ++k) {
+        size_t i    = (k < m ? 0 : k - m + 1);
+        size_t iEnd = (k + 1) / 2; // i < k - i
+        productComp acc  = 0;
+        productComp high = 0;
+        while (i < iEnd) {
+            size_t gEnd = std::min(iEnd, i + C_TIMES_COMBA_GROUP);
+            for (; i < gEnd; ++i) {
+                acc += static_cast<productComp>(u[i]) * static_cast<productComp>(u[k - i]);
+            }
+            high += acc / B;
+            acc  %= B;
+        }
+        // 2 * (high * B + acc) + square + carry
+        acc = 2 * acc + carry % B;
+        if (k % 2 == 0) {
+            acc += static_cast<productComp>(u[k / 2]) * static_cast<productComp>(u[k / 2]);
+        }
+        w[k]  = static_cast<singleComp>(acc % B);
+        carry = 2 * high + carry / B + acc / B;
+    }
+    w[2 * m - 1] = static_cast<singleComp>(carry);
+}
+
+void aint::impl::operatorSquareToomCook(singleComp* w, const singleComp* u, size_t m) {
+    if (m < C_TIMES_TOOM3_THRESHOLD) {
+        operatorSquareKaratsuba(w, u, m);
+    } else if (m < C_TIMES_TOOM4_THRESHOLD) {
+        operatorSquareToom3(w, u, m);
+    } else {
+        operatorSquareToom4(w, u, m);
+    }
+}
+
+void aint::impl::operatorSquareLimbs(singleComp* w, const singleComp* u, size_t m) {
+    // the same bands as for the product (see operatorTimesBalanced)
+    if (m < C_SQUARE_KARATSUBA_THRESHOLD) {
+        operatorSquareBasecase(w, u, m);
+    } else if (m < transformThreshold(C_SQUARE_FFT_THRESHOLD) || !operatorTimesTransform(w, u, m, u, m, C_SQUARE_FFT_THRESHOLD)) {
+        operatorSquareToomCook(w, u, m);
+    }
+}
+
+void aint::impl::operatorTimesUnbalanced(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n) {
+    // split u into q blocks of (nearly) equal size c <= C_TIMES_UNBALANCED_RATIO * n and
+    // compute u * v = sum of (u[i..i+c) * v) * B^i, where i = 0, c, 2c, ...
+    size_t q = (m + C_TIMES_UNBALANCED_RATIO * n - 1) / (C_TIMES_UNBALANCED_RATIO * n);
+    size_t c = (m + q - 1) / q;
+    operatorTimesBalanced(w, u, c, v, n);
+    scratchBuffer<singleComp> t(c + n);
+    for (size_t i = c; i < m; i += c) {
+        // w[i..i+n) holds the upper part of the previous block
+        size_t k = std::min(c, m - i);
+        operatorTimesLimbs(t.data(), u + i, k, v, n);
+        std::fill(w + i + n, w + i + n + k, 0);
+        limbsAdd(w + i, w + i, n + k, t.data(), n + k);
+    }
+}
+
+void aint::impl::operatorTimesLimbs(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n) {
+    if (u == v && m == n) {
+        operatorSquareLimbs(w, u, m);
+        return;
+    }
+    // make sure u is the longer factor
+    if (m < n) {
+        std::swap(u, v);
+        std::swap(m, n);
+    }
+    if (n < C_TIMES_KARATSUBA_THRESHOLD) {
+        operatorTimesBasecase(w, u, m, v, n);
+    } else if (m > C_TIMES_UNBALANCED_RATIO * n) {
+        operatorTimesUnbalanced(w, u, m, v, n);
+    } else {
+        operatorTimesBalanced(w, u, m, v, n);
+    }
+}
+
+size_t aint::impl::transformThreshold(size_t fft) {
+    // the smallest size at which one of the transforms of the selected algorithm is used
+    size_t t = C_TIMES_SSA_THRESHOLD;
+    if (timesAlgorithm_ != TIMES_SSA) {
+        t = std::min<size_t>(t, C_TIMES_NTT_THRESHOLD);
+    }
+    if (timesAlgorithm_ == TIMES_AUTO || timesAlgorithm_ == TIMES_FFT) {
+        t = std::min(t, fft);
+    }
+    return(t);
+}
+
+bool aint::impl::operatorTimesTransform(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n, size_t fft) {
+    // every transform is used above its own crossover only, the floating-point FFT refuses
+    // factors if its result could be inexact and the number-theoretic transform factors
+    // which are too long (then the next transform is tried)
+    if (n >= fft && (timesAlgorithm_ == TIMES_AUTO || timesAlgorithm_ == TIMES_FFT) && operatorTimesFFT(w, u, m, v, n)) {
+        return(true);
+    }
+    if (n >= C_TIMES_NTT_THRESHOLD && timesAlgorithm_ != TIMES_SSA && operatorTimesNTT(w, u, m, v, n)) {
+        return(true);
+    }
+    if (n >= C_TIMES_SSA_THRESHOLD) {
+        operatorTimesSSA(w, u, m, v, n);
+        return(true);
+    }
+    return(false);
+}
+
+void aint::impl::operatorTimesToomCook(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n) {
+    if (n < C_TIMES_TOOM3_THRESHOLD || 3 * n <= 2 * m) {
+        // Karatsuba's algorithm also handles factors of different size
+        operatorTimesKaratsuba(w, u, m, v, n);
+    } else if (n < C_TIMES_TOOM4_THRESHOLD || 4 * n <= 3 * m) {
+        operatorTimesToom3(w, u, m, v, n);
+    } else {
+        operatorTimesToom4(w, u, m, v, n);
+    }
+}
+
+void aint::impl::operatorTimesBalanced(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n) {
+    // each algorithm covers its own band of sizes (of the shorter factor): the schoolbook
+    // multiplication up to C_TIMES_KARATSUBA_THRESHOLD, Karatsuba's algorithm up to
+    // C_TIMES_TOOM3_THRESHOLD, Toom-3 up to C_TIMES_TOOM4_THRESHOLD and Toom-4 up to the
+    // smallest threshold of the transforms (the Toom-Cook algorithms also multiply the
+    // factors which all transforms refuse)
+    if (n < C_TIMES_KARATSUBA_THRESHOLD) {
+        operatorTimesBasecase(w, u, m, v, n);
+    } else if (n < transformThreshold(C_TIMES_FFT_THRESHOLD) || !operatorTimesTransform(w, u, m, v, n, C_TIMES_FFT_THRESHOLD)) {
+        operatorTimesToomCook(w, u, m, v, n);
+    }
+}
+
+void aint::impl::operatorSquare(const aint& lhs, aint& res) const {
+    // compute res = lhs * lhs
+    const data& u = lhs.pimpl()->data_;
+    data& w = res.pimpl()->data_;
+    size_t m = u.size();
+    if (&res == &lhs) {
+        // the product is computed in the scratch arena and copied, so that res keeps its capacity
+        scratchBuffer<singleComp> tmp(2 * m);
+        operatorSquareLimbs(tmp.data(), u.data(), m);
+        w.resizeUninitialised(2 * m);
+        std::copy(tmp.begin(), tmp.end(), w.begin());
+    } else {
+        // the kernels write all components of the product
+        w.resizeUninitialised(2 * m);
+        operatorSquareLimbs(w.data(), u.data(), m);
+    }
+    res.pimpl()->removeLeadingZeros();
+    res.pimpl()->positive_ = true;
 }
 
 void aint::impl::operatorTimes( const aint& lhs, const aint& rhs, aint& res) const {
-    // compute res = lhs * rhs
-    data& v = rhs.impl_->data_;
+    // compute res = lhs * rhs, res may be lhs or rhs (e.g. for operator*=)
+    if (&lhs == &rhs) {
+        // use operatorSquare from above
+        this->operatorSquare(lhs, res);
+        return;
+    }
+    const data& v = rhs.pimpl()->data_;
     size_t n = v.size();
     if (n == 1) {
         // use operatorTimesSgl from above
-        this->operatorTimesSingle(lhs, (rhs.impl_->positive_ ? v[0] : -v[0]), res);
+        this->operatorTimesSingle(lhs, (rhs.pimpl()->positive_ ? v[0] : -v[0]), res);
         return;
     }
-    data& u = lhs.impl_->data_;
-    data& w = res.impl_->data_;
+    const data& u = lhs.pimpl()->data_;
+    data& w = res.pimpl()->data_;
     size_t m = u.size();
-    // use D.Knuth's algorithm M from TAoCP, Vol 2, 4.3.1;
-    res.impl_->resizeAndZeroise(m + n);
-    // skip the 'for (int i = 0; i < m; ++i) { w[i] = 0; }' in algorithm M, because every entry in w is set to 0 by resizeAndZeroise
-    for (int j = 0; j < n; ++j) {
-        doubleComp carry = 0;
-        for (int i = 0; i < m; ++i) {
-            // promote the first operand to doubleComp
-            // to ensure doubleComp-arithmetic is used
-            doubleComp tmp = static_cast<doubleComp>(u[i]) * v[j] + w[i + j] + carry;
-            w[i + j] = tmp % C_SINGLE_COMP_MAX_P1;
-            carry    = tmp / C_SINGLE_COMP_MAX_P1;
-        }
-        w[m + j] = carry;
+    const bool positive = (lhs.pimpl()->positive_ == rhs.pimpl()->positive_ ? true : false);
+    if (&res == &lhs || &res == &rhs) {
+        // the product is computed in the scratch arena and copied (see above)
+        scratchBuffer<singleComp> tmp(m + n);
+        operatorTimesLimbs(tmp.data(), u.data(), m, v.data(), n);
+        w.resizeUninitialised(m + n);
+        std::copy(tmp.begin(), tmp.end(), w.begin());
+    } else {
+        w.resizeUninitialised(m + n);
+        operatorTimesLimbs(w.data(), u.data(), m, v.data(), n);
     }
-    res.impl_->removeLeadingZeros();
+    res.pimpl()->removeLeadingZeros();
     // set sign of result
-    res.impl_->positive_ = (lhs.impl_->positive_ == rhs.impl_->positive_ ? true : false);
+    res.pimpl()->positive_ = positive;
+    res.pimpl()->makeZeroPositive();
 }
 
 } // end of namespace astd
@@ -0,0 +1,365 @@
+/*
+ *  This file is part of aint.
+ *
+ *  aint provides a C++ class for arbitrary long integers which can be
+ *  used the same way as the C/C++ integer types (e.g. int or long),
+ *  but has no restriction on the length (if there is enough memory).
+ *  Aim of this project is to include fast integer multiplications
+ *  like the Toom-Cook algorithm or the Schoenhage-Strassen algorithm.
+ *  Copyright (C) 2014 Mario Baumann (mario-baumann@web.de)
+ *
+ *  aint is free software: you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  aint is distributed in the hope that it will be useful, but
+ *  WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with aint.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************/
+
+// arbitrary long integer
+// impl_operator_times_fft.cxx (helper functions for the floating-point FFT)
+
+#include "impl.hxx"
+#include <algorithm> // std::fill, std::max
+#include <cmath>     // std::cos, std::sin, std::floor, std::log1p, std::expm1
+#include <complex>   // std::complex
+
+namespace {
+
+typedef std::complex<double> cplx;
+
+//
+// maximum length of the transforms (limits the memory usage)
+//
+const size_t C_FFT_MAX_LENGTH = size_t(1) << 24;
+
+// complex multiplication without the special handling of inf and nan
+inline cplx fftMul(const cplx& a, const cplx& b) {
+    return(cplx(a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real()));
+}
+
+//
+// fills rt[0..N/2) with the twiddle factors exp(-2 pi i j / N); sin and cos are
+// only evaluated in the first octant (the other values follow by exact symmetries),
+// so each twiddle factor has an absolute error of at most 2^-51 (assuming sin and
+// cos are accurate to one ulp)
+//
+void fftRoots(cplx* rt, size_t N, size_t parts = 1) {
+    const double twoPi = 6.283185307179586476925;
+    astd::parallelFor(parts, [rt, N, parts, twoPi](size_t p) {
+        for (size_t j = N / 2 * p / parts; j < N / 2 * (p + 1) / parts; ++j) {
+            double c, s;
+            if (8 * j <= N) {
+                double phi = twoPi * (static_cast<double>(j) / N);
+                c =  std::cos(phi);
+                s =  std::sin(phi);
+            } else if (4 * j <= N) {
+                double phi = twoPi * (static_cast<double>(N / 4 - j) / N);
+                c =  std::sin(phi);
+                s =  std::cos(phi);
+            } else if (8 * j <= 3 * N) {
+                double phi = twoPi * (static_cast<double>(j - N / 4) / N);
+                c = -std::sin(phi);
+                s =  std::cos(phi);
+            } else {
+                double phi = twoPi * (static_cast<double>(N / 2 - j) / N);
+                c = -std::cos(phi);
+                s =  std::sin(phi);
+            }
+            rt[j] = cplx(c, -s);
+        }
+    });
+}
+
+//
+// returns the twiddle factors for transforms of length N, i.e. rt[j * stride] = exp(-2 pi i j / N),
+// in rt[0..N/2) (a buffer in the scratch arena); the table of the short transforms (up to
+// C_FFT_CACHED_LENGTH) is kept per thread instead, since many short products (e.g. the blocks of
+// unbalanced products) would otherwise spend most time in sin and cos
+//
+const size_t C_FFT_CACHED_LENGTH = size_t(1) << 16;
+
+// table of the twiddle factors of one thread, allocated with the memory functions of aint
+class fftRootCache {
+
+public:
+    fftRootCache() : rt_(NULL), size_(0) {
+    }
+    ~fftRootCache() {
+        if (rt_ != NULL) {
+            astd::memory::free(rt_, size_ * sizeof(cplx));
+        }
+    }
+    //! returns the table for transforms of length N (of length N or longer)
+    const cplx* roots(size_t N) {
+        if (size_ < N / 2) {
+            size_t n = std::max(N, C_FFT_CACHED_LENGTH / 16);
+            cplx* rt = static_cast<cplx*>(astd::memory::allocate(n / 2 * sizeof(cplx)));
+            fftRoots(rt, n);
+            if (rt_ != NULL) {
+                astd::memory::free(rt_, size_ * sizeof(cplx));
+            }
+            rt_   = rt;
+            size_ = n / 2;
+        }
+        return(rt_);
+    }
+    //! returns the number of twiddle factors
+    size_t size() const {
+        return(size_);
+    }
+
+private:
+    fftRootCache(const fftRootCache&);
+    fftRootCache& operator=(const fftRootCache&);
+
+    //! twiddle factors exp(-2 pi i j / (2 * size_)) for j < size_
+    cplx* rt_;
+    size_t size_;
+};
+
+const cplx* fftRoots(astd::scratchBuffer<cplx>& rt, size_t N, size_t& stride, size_t parts) {
+    if (N > C_FFT_CACHED_LENGTH) {
+        fftRoots(rt.data(), N, parts);
+        stride = 1;
+        return(rt.data());
+    }
+    static thread_local fftRootCache cache;
+    const cplx* roots = cache.roots(N);
+    stride = cache.size() / (N / 2);
+    return(roots);
+}
+
+//
+// forward transform (decimation in frequency), the result is in bit-reversed order
+//
+void fftForward(cplx* a, size_t N, const cplx* rt, size_t rtStride) {
+    for (size_t h = N / 2; h >= 1; h /= 2) {
+        size_t stride = N / (2 * h) * rtStride;
+        for (size_t s = 0; s < N; s += 2 * h) {
+            cplx* x = a + s;
+            cplx* y = a + s + h;
+            for (size_t j = 0; j < h; ++j) {
+                cplx t = x[j];
+                x[j] = t + y[j];
+                y[j] = fftMul(t - y[j], rt[j * stride]);
+            }
+        }
+    }
+}
+
+//
+// inverse transform (decimation in time) of data in bit-reversed order,
+// the result is in natural order and not yet divided by N
+//
+void fftInverse(cplx* a, size_t N, const cplx* rt, size_t rtStride) {
+    for (size_t h = 1; h < N; h *= 2) {
+        size_t stride = N / (2 * h) * rtStride;
+        for (size_t s = 0; s < N; s += 2 * h) {
+            cplx* x = a + s;
+            cplx* y = a + s + h;
+            for (size_t j = 0; j < h; ++j) {
+                cplx t = fftMul(y[j], std::conj(rt[j * stride]));
+                y[j] = x[j] - t;
+                x[j] = x[j] + t;
+            }
+        }
+    }
+}
+
+//
+// the transforms above split into parts (a power of two) threads: the stages with
+// blocks longer than N / parts share the butterflies of each block, the other
+// stages work on parts independent blocks of length N / parts
+//
+void fftForward(cplx* a, size_t N, const cplx* rt, size_t rtStride, size_t parts) {
+    size_t h = N / 2;
+    for (; parts > 1 && h >= N / parts; h /= 2) {
+        size_t stride = N / (2 * h) * rtStride;
+        astd::parallelFor(parts, [=](size_t p) {
+            for (size_t s = 0; s < N; s += 2 * h) {
+                cplx* x = a + s;
+                cplx* y = a + s + h;
+                for (size_t j = h * p / parts; j < h * (p + 1) / parts; ++j) {
+                    cplx t = x[j];
+                    x[j] = t + y[j];
+                    y[j] = fftMul(t - y[j], rt[j * stride]);
+                }
+            }
+        });
+    }
+    size_t len = 2 * h;
+    astd::parallelFor(N / len, [=](size_t p) {
+        fftForward(a + p * len, len, rt, rtStride * (N / len));
+    });
+}
+
+void fftInverse(cplx* a, size_t N, const cplx* rt, size_t rtStride, size_t parts) {
+    size_t len = N / parts;
+    astd::parallelFor(parts, [=](size_t p) {
+        fftInverse(a + p * len, len, rt, rtStride * parts);
+    });
+    for (size_t h = len; h < N; h *= 2) {
+        size_t stride = N / (2 * h) * rtStride;
+        astd::parallelFor(parts, [=](size_t p) {
+            for (size_t s = 0; s < N; s += 2 * h) {
+                cplx* x = a + s;
+                cplx* y = a + s + h;
+                for (size_t j = h * p / parts; j < h * (p + 1) / parts; ++j) {
+                    cplx t = fftMul(y[j], std::conj(rt[j * stride]));
+                    y[j] = x[j] - t;
+                    x[j] = x[j] + t;
+                }
+            }
+        });
+    }
+}
+
+//
+// returns the factor f, so that the maximum error of a convolution x * y of length
+// N = 2^n computed with the transforms above is less than ||x|| * ||y|| * f,
+// see C.Percival, Rapid multiplication modulo the sum and difference of highly
+// composite numbers, Math. Comp. 72 (2003), or R.Brent and P.Zimmermann,
+// Modern Computer Arithmetic, Theorem 3.3.2
+//
+double fftErrorFactor(size_t N) {
+    const double eps  = std::ldexp(1.0, -53); // unit roundoff
+    const double beta = std::ldexp(1.0, -51); // error of the twiddle factors
+    double n = 0;
+    while ((size_t(1) << static_cast<size_t>(n)) < N) {
+        n += 1;
+    }
+    double e = 3 * n * std::log1p(eps) + (3 * n + 1) * std::log1p(eps * std::sqrt(5.0)) + 3 * n * std::log1p(beta);
+    // add a safety margin for the rounding errors of this computation
+    return(std::expm1(e) * (1 + 1.0 / 1024));
+}
+
+//
+// returns the piece of d digits starting at digit off of u[k] (its upper digits are
+// the lower digits of u[k + 1] if off + d > W), where power[j] = R^j; the single
+// components are not combined, since two of them may not fit into 64 bits
+//
+template <typename T>
+inline uint64_t fftPiece(const T* u, size_t m, size_t k, size_t off, size_t d, size_t W, const uint64_t* power) {
+    uint64_t x = (k < m ? static_cast<uint64_t>(u[k]) : 0) / power[off];
+    if (off + d <= W) {
+        return(x % power[d]);
+    }
+    uint64_t y = (k + 1 < m ? static_cast<uint64_t>(u[k + 1]) : 0) % power[off + d - W];
+    return(x + y * power[W - off]);
+}
+
+} // end of namespace
+
+namespace astd {
+
+bool aint::impl::operatorTimesFFT(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n) {
+    // split u and v into pieces of d digits, store them in the real and
+    // imaginary part of z = x + i*y and use x * y = Im(z * z) / 2; so the error
+    // of the coefficients is less than (||x||^2 + ||y||^2) / 2 * fftErrorFactor(N)
+    // and d is the largest number of digits for which this error is less than 1/2
+    const bool square = (u == v && m == n);
+    const size_t W = C_SINGLE_COMP_WIDTH;
+    // powers of the digits of the single components (decimal digits, or bits with BINARY_RADIX)
+#if defined(BINARY_RADIX)
+    const uint64_t R = 2;
+#else
+    const uint64_t R = 10;
+#endif
+    uint64_t power[8 * sizeof(uint64_t)];
+    power[0] = 1;
+    for (size_t j = 1; j <= W; ++j) {
+        power[j] = power[j - 1] * R;
+    }
+    size_t d  = W;
+    size_t pu = 0;
+    size_t pv = 0;
+    size_t N  = 0;
+    for (; d >= 1; --d) {
+        pu = (m * W + d - 1) / d;
+        pv = (n * W + d - 1) / d;
+        N  = 1;
+        while (N < pu + pv - 1) {
+            N *= 2;
+        }
+        double b = static_cast<double>(power[d] - 1);
+        double norm = (square ? pu : 0.5 * (pu + pv)) * b * b;
+        if (N <= C_FFT_MAX_LENGTH && norm * fftErrorFactor(N) < 0.5) {
+            break;
+        }
+    }
+    if (d == 0) {
+        // exactness cannot be guaranteed
+        return(false);
+    }
+    const size_t L = nttLength(m, n);
+    if (timesAlgorithm_ == TIMES_AUTO && N > 2 * L && n >= (square ? C_SQUARE_FFT_NTT_THRESHOLD : C_TIMES_FFT_NTT_THRESHOLD)) {
+        // the number-theoretic transform is faster above its measured crossover: it needs
+        // 9 transforms of length L (6 for squares), the FFT 2 transforms of length N (but
+        // of complex numbers), the FFT of at most twice the length of the NTT is faster
+        return(false);
+    }
+    //
+    const uint64_t BD = power[d];
+    scratchBuffer<cplx> a(N, cplx(0, 0));
+    for (size_t i = 0; i < pu || (!square && i < pv); ++i) {
+        // extract the pieces starting at digit position i * d
+        size_t k   = i * d / W;
+        size_t off = i * d % W;
+        double x = 0, y = 0;
+        if (i < pu) {
+            x = static_cast<double>(fftPiece(u, m, k, off, d, W, power));
+        }
+        if (!square && i < pv) {
+            y = static_cast<double>(fftPiece(v, n, k, off, d, W, power));
+        }
+        a[i] = cplx(x, y);
+    }
+    const size_t parts = threadParts(n, N);
+    scratchBuffer<cplx> rtLocal(N > C_FFT_CACHED_LENGTH ? N / 2 : 0);
+    size_t rtStride = 1;
+    const cplx* rt = fftRoots(rtLocal, N, rtStride, parts);
+    fftForward(a.data(), N, rt, rtStride, parts);
+    cplx* z = a.data();
+    parallelFor(parts, [z, N, parts](size_t p) {
+        for (size_t i = N * p / parts; i < N * (p + 1) / parts; ++i) {
+            z[i] = fftMul(z[i], z[i]);
+        }
+    });
+    fftInverse(a.data(), N, rt, rtStride, parts);
+    //
+    // round the coefficients, propagate the carry in base R^d and
+    // put the pieces of d digits back into single components
+    const double f = (square ? 1.0 : 0.5) / N;
+    std::fill(w, w + m + n, 0);
+    uint64_t carry = 0;
+    for (size_t i = 0; i < pu + pv - 1 || carry > 0; ++i) {
+        uint64_t c = carry;
+        if (i < pu + pv - 1) {
+            c += static_cast<uint64_t>(std::floor((square ? a[i].real() : a[i].imag()) * f + 0.5));
+        }
+        carry = c / BD;
+        // the piece c % BD starts at digit off of w[k], its upper digits
+        // belong to w[k + 1] (the pieces do not overlap, so there is no
+        // carry between the single components)
+        size_t   k   = i * d / W;
+        size_t   off = i * d % W;
+        uint64_t t   = c % BD;
+        if (k < m + n) {
+            w[k] += static_cast<singleComp>(t % power[W - off] * power[off]);
+        }
+        if (k + 1 < m + n) {
+            w[k + 1] += static_cast<singleComp>(t / power[W - off]);
+        }
+    }
+    return(true);
+}
+
+} // end of namespace astd
@@ -0,0 +1,125 @@
+/*
+ *  This file is part of aint.
+ *
+ *  aint provides a C++ class for arbitrary long integers which can be
+ *  used the same way as the C/C++ integer types (e.g. int or long),
+ *  but has no restriction on the length (if there is enough memory).
+ *  Aim of this project is to include fast integer multiplications
+ *  like the Toom-Cook algorithm or the Schoenhage-Strassen algorithm.
+ *  Copyright (C) 2014 Mario Baumann (mario-baumann@web.de)
+ *
+ *  aint is free software: you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  aint is distributed in the hope that it will be useful, but
+ *  WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with aint.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************/
+
+// arbitrary long integer
+// impl_operator_times_karatsuba.cxx (Karatsuba's algorithm for operator times)
+
+#include "impl.hxx"
+#include <algorithm> // std::copy, std::fill
+
+namespace astd {
+
+void aint::impl::operatorTimesKaratsuba(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n) {
+    // compute w = u * v with Karatsuba's algorithm, see also TAoCP, Vol 2, 4.3.3
+    // and http://en.wikipedia.org/wiki/Karatsuba_algorithm
+    //
+    // with u = u1 * B^k + u0 and v = v1 * B^k + v0 we get
+    //
+    //   u * v = z2 * B^2k + (z0 + z2 - (u0 - u1) * (v0 - v1)) * B^k + z0
+    //
+    // where z0 = u0 * v0 and z2 = u1 * v1, i.e. three instead of four multiplications
+    size_t k = (m + 1) / 2;
+
+    if (n <= k) {
+        // v is too short to be split, therefore compute u0 * v + u1 * v * B^k
+        scratchBuffer<singleComp> t(m - k + n);
+        operatorTimesLimbs(w, u, k, v, n);
+        operatorTimesLimbs(t.data(), u + k, m - k, v, n);
+        std::fill(w + k + n, w + m + n, 0);
+        limbsAdd(w + k, w + k, m + n - k, t.data(), t.size());
+        return;
+    }
+
+    // z0 = u0 * v0 is stored in w[0..2k), z2 = u1 * v1 in w[2k..m+n)
+    operatorTimesLimbs(w, u, k, v, k);
+    operatorTimesLimbs(w + 2 * k, u + k, m - k, v + k, n - k);
+
+    // du = abs(u0 - u1), dv = abs(v0 - v1)
+    scratchBuffer<singleComp> du(k, 0);
+    scratchBuffer<singleComp> dv(k, 0);
+    bool uNeg = (limbsCmp(u, k, u + k, m - k) < 0);
+    bool vNeg = (limbsCmp(v, k, v + k, n - k) < 0);
+    if (uNeg) {
+        limbsSub(du.data(), u + k, m - k, u, limbsSize(u, k));
+    } else {
+        limbsSub(du.data(), u, k, u + k, m - k);
+    }
+    if (vNeg) {
+        limbsSub(dv.data(), v + k, n - k, v, limbsSize(v, k));
+    } else {
+        limbsSub(dv.data(), v, k, v + k, n - k);
+    }
+
+    // p = du * dv
+    scratchBuffer<singleComp> p(2 * k);
+    operatorTimesLimbs(p.data(), du.data(), k, dv.data(), k);
+
+    // t = z0 + z2 -/+ p (which is equal to u0 * v1 + u1 * v0 and therefore never negative)
+    scratchBuffer<singleComp> t(2 * k + 1, 0);
+    std::copy(w, w + 2 * k, t.begin());
+    limbsAdd(t.data(), t.data(), t.size(), w + 2 * k, m + n - 2 * k);
+    if (uNeg == vNeg) {
+        limbsSub(t.data(), t.data(), t.size(), p.data(), p.size());
+    } else {
+        limbsAdd(t.data(), t.data(), t.size(), p.data(), p.size());
+    }
+
+    // w += t * B^k
+    limbsAdd(w + k, w + k, m + n - k, t.data(), limbsSize(t.data(), t.size()));
+}
+
+void aint::impl::operatorSquareKaratsuba(singleComp* w, const singleComp* u, size_t m) {
+    // compute w = u * u with Karatsuba's algorithm, i.e.
+    //
+    //   u * u = z2 * B^2k + (z0 + z2 - (u0 - u1)^2) * B^k + z0
+    //
+    // where z0 = u0 * u0 and z2 = u1 * u1 (three squares)
+    size_t k = (m + 1) / 2;
+
+    // z0 is stored in w[0..2k), z2 in w[2k..2m)
+    operatorSquareLimbs(w, u, k);
+    operatorSquareLimbs(w + 2 * k, u + k, m - k);
+
+    // p = (u0 - u1)^2
+    scratchBuffer<singleComp> du(k, 0);
+    if (limbsCmp(u, k, u + k, m - k) < 0) {
+        limbsSub(du.data(), u + k, m - k, u, limbsSize(u, k));
+    } else {
+        limbsSub(du.data(), u, k, u + k, m - k);
+    }
+    scratchBuffer<singleComp> p(2 * k);
+    operatorSquareLimbs(p.data(), du.data(), k);
+
+    // t = z0 + z2 - p (which is equal to 2 * u0 * u1)
+    scratchBuffer<singleComp> t(2 * k + 1, 0);
+    std::copy(w, w + 2 * k, t.begin());
+    limbsAdd(t.data(), t.data(), t.size(), w + 2 * k, 2 * m - 2 * k);
+    limbsSub(t.data(), t.data(), t.size(), p.data(), p.size());
+
+    // w += t * B^k
+    limbsAdd(w + k, w + k, 2 * m - k, t.data(), limbsSize(t.data(), t.size()));
+}
+
+} // end of namespace astd
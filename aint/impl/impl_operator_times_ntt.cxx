@@ -0,0 +1,319 @@
+/*
+ *  This file is part of aint.
+ *
+ *  aint provides a C++ class for arbitrary long integers which can be
+ *  used the same way as the C/C++ integer types (e.g. int or long),
+ *  but has no restriction on the length (if there is enough memory).
+ *  Aim of this project is to include fast integer multiplications
+ *  like the Toom-Cook algorithm or the Schoenhage-Strassen algorithm.
+ *  Copyright (C) 2014 Mario Baumann (mario-baumann@web.de)
+ *
+ *  aint is free software: you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  aint is distributed in the hope that it will be useful, but
+ *  WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with aint.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************/
+
+// arbitrary long integer
+// impl_operator_times_ntt.cxx (helper functions for the number-theoretic transform)
+
+#include "impl.hxx"
+#include <algorithm> // std::fill
+
+namespace {
+
+//
+// the number-theoretic transforms work modulo three primes p = c * 2^k + 1 < 2^31,
+// so that all products of residues fit into 64 bit, and the length of the
+// transforms is limited by the smallest 2^k
+//
+const uint32_t P1 = 2013265921; // 15 * 2^27 + 1, primitive root 31
+const uint32_t P2 =  469762049; //  7 * 2^26 + 1, primitive root 3
+const uint32_t P3 =  167772161; //  5 * 2^25 + 1, primitive root 3
+const size_t   C_NTT_MAX_LENGTH = size_t(1) << 25;
+
+template <uint32_t P>
+inline uint32_t nttAdd(uint32_t a, uint32_t b) {
+    uint32_t s = a + b; // no overflow, since P < 2^31
+    return(s >= P ? s - P : s);
+}
+
+template <uint32_t P>
+inline uint32_t nttSub(uint32_t a, uint32_t b) {
+    return(a >= b ? a - b : a + P - b);
+}
+
+template <uint32_t P>
+inline uint32_t nttMul(uint32_t a, uint32_t b) {
+    return(static_cast<uint32_t>(static_cast<uint64_t>(a) * b % P));
+}
+
+template <uint32_t P>
+uint32_t nttPow(uint32_t a, uint32_t e) {
+    uint32_t r = 1;
+    while (e > 0) {
+        if (e & 1) r = nttMul<P>(r, a);
+        a = nttMul<P>(a, a);
+        e >>= 1;
+    }
+    return(r);
+}
+
+template <uint32_t P>
+inline uint32_t nttInv(uint32_t a) {
+    return(nttPow<P>(a, P - 2));
+}
+
+//
+// fills rt[h..2h) with the powers w^0, ..., w^(h-1) of a primitive 2h-th
+// root of unity w for all h = 1, 2, 4, ..., L/2 (so rt has L entries)
+//
+template <uint32_t P, uint32_t G>
+void nttRoots(uint32_t* rt, size_t L, bool inverse) {
+    for (size_t h = 1; h < L; h *= 2) {
+        uint32_t w = nttPow<P>(G, static_cast<uint32_t>((P - 1) / (2 * h)));
+        if (inverse) w = nttInv<P>(w);
+        rt[h] = 1;
+        for (size_t j = 1; j < h; ++j) {
+            rt[h + j] = nttMul<P>(rt[h + j - 1], w);
+        }
+    }
+}
+
+//
+// forward transform (decimation in frequency), the result is in bit-reversed order
+//
+template <uint32_t P>
+void nttForward(uint32_t* a, size_t L, const uint32_t* rt) {
+    for (size_t h = L / 2; h >= 1; h /= 2) {
+        for (size_t s = 0; s < L; s += 2 * h) {
+            uint32_t* x = a + s;
+            uint32_t* y = a + s + h;
+            for (size_t j = 0; j < h; ++j) {
+                uint32_t t = x[j];
+                x[j] = nttAdd<P>(t, y[j]);
+                y[j] = nttMul<P>(nttSub<P>(t, y[j]), rt[h + j]);
+            }
+        }
+    }
+}
+
+//
+// inverse transform (decimation in time) of data in bit-reversed order,
+// the result is in natural order and not yet divided by L
+//
+template <uint32_t P>
+void nttInverse(uint32_t* a, size_t L, const uint32_t* rt) {
+    for (size_t h = 1; h < L; h *= 2) {
+        for (size_t s = 0; s < L; s += 2 * h) {
+            uint32_t* x = a + s;
+            uint32_t* y = a + s + h;
+            for (size_t j = 0; j < h; ++j) {
+                uint32_t t = nttMul<P>(y[j], rt[h + j]);
+                y[j] = nttSub<P>(x[j], t);
+                x[j] = nttAdd<P>(x[j], t);
+            }
+        }
+    }
+}
+
+//
+// the transforms above split into parts (a power of two) threads: the stages with
+// blocks longer than L / parts share the butterflies of each block, the other
+// stages work on parts independent blocks of length L / parts (rt is the same,
+// since it holds the roots of each stage separately)
+//
+template <uint32_t P>
+void nttForward(uint32_t* a, size_t L, const uint32_t* rt, size_t parts) {
+    size_t h = L / 2;
+    for (; parts > 1 && h >= L / parts; h /= 2) {
+        astd::parallelFor(parts, [=](size_t p) {
+            for (size_t s = 0; s < L; s += 2 * h) {
+                uint32_t* x = a + s;
+                uint32_t* y = a + s + h;
+                for (size_t j = h * p / parts; j < h * (p + 1) / parts; ++j) {
+                    uint32_t t = x[j];
+                    x[j] = nttAdd<P>(t, y[j]);
+                    y[j] = nttMul<P>(nttSub<P>(t, y[j]), rt[h + j]);
+                }
+            }
+        });
+    }
+    size_t len = 2 * h;
+    astd::parallelFor(L / len, [=](size_t p) {
+        nttForward<P>(a + p * len, len, rt);
+    });
+}
+
+template <uint32_t P>
+void nttInverse(uint32_t* a, size_t L, const uint32_t* rt, size_t parts) {
+    size_t len = L / parts;
+    astd::parallelFor(parts, [=](size_t p) {
+        nttInverse<P>(a + p * len, len, rt);
+    });
+    for (size_t h = len; h < L; h *= 2) {
+        astd::parallelFor(parts, [=](size_t p) {
+            for (size_t s = 0; s < L; s += 2 * h) {
+                uint32_t* x = a + s;
+                uint32_t* y = a + s + h;
+                for (size_t j = h * p / parts; j < h * (p + 1) / parts; ++j) {
+                    uint32_t t = nttMul<P>(y[j], rt[h + j]);
+                    y[j] = nttSub<P>(x[j], t);
+                    x[j] = nttAdd<P>(x[j], t);
+                }
+            }
+        });
+    }
+}
+
+//
+// computes r[0..L) = u[0..m) * v[0..n) modulo P (as cyclic convolution of length L)
+// with parts threads
+//
+template <uint32_t P, uint32_t G, typename T>
+void nttConvolution(uint32_t* r, const T* u, size_t m, const T* v, size_t n, size_t L, size_t parts) {
+    astd::scratchBuffer<uint32_t> rt(L);
+    nttRoots<P, G>(rt.data(), L, false);
+    std::fill(r, r + L, 0);
+    for (size_t i = 0; i < m; ++i) {
+        r[i] = static_cast<uint32_t>(u[i]) % P;
+    }
+    nttForward<P>(r, L, rt.data(), parts);
+    // divide by L together with the pointwise products
+    const uint32_t f = nttInv<P>(static_cast<uint32_t>(L % P));
+    uint32_t* x = r;
+    if (u == v && m == n) {
+        // squaring needs one transform only
+        astd::parallelFor(parts, [=](size_t p) {
+            for (size_t i = L * p / parts; i < L * (p + 1) / parts; ++i) {
+                x[i] = nttMul<P>(nttMul<P>(x[i], x[i]), f);
+            }
+        });
+    } else {
+        astd::scratchBuffer<uint32_t> s(L, 0);
+        for (size_t i = 0; i < n; ++i) {
+            s[i] = static_cast<uint32_t>(v[i]) % P;
+        }
+        nttForward<P>(s.data(), L, rt.data(), parts);
+        const uint32_t* y = s.data();
+        astd::parallelFor(parts, [=](size_t p) {
+            for (size_t i = L * p / parts; i < L * (p + 1) / parts; ++i) {
+                x[i] = nttMul<P>(nttMul<P>(x[i], y[i]), f);
+            }
+        });
+    }
+    nttRoots<P, G>(rt.data(), L, true);
+    nttInverse<P>(r, L, rt.data(), parts);
+}
+
+//
+// computes the convolution of u and v modulo the three primes and reconstructs
+// its coefficients with the Chinese remainder theorem (Garner's algorithm);
+// the coefficients are less than min(m, n) * B^2 < P1 * P2 * P3, they are
+// written with their carries as m + n components of base B < 2^32 to w
+//
+template <typename T>
+void nttTimes(T* w, const T* u, size_t m, const T* v, size_t n, size_t L, size_t parts, uint64_t B) {
+    astd::scratchBuffer<uint32_t> r1(L), r2(L), r3(L);
+    nttConvolution<P1, 31>(r1.data(), u, m, v, n, L, parts);
+    nttConvolution<P2,  3>(r2.data(), u, m, v, n, L, parts);
+    nttConvolution<P3,  3>(r3.data(), u, m, v, n, L, parts);
+    //
+    // x = v1 + v2 * P1 + v3 * P1 * P2, where 0 <= vk < Pk (v2 and v3 replace r2 and r3)
+    const uint32_t i12 = nttInv<P2>(P1 % P2);
+    const uint32_t i13 = nttInv<P3>(P1 % P3);
+    const uint32_t i23 = nttInv<P3>(P2 % P3);
+    const size_t   wn  = m + n - 1;
+    uint32_t* x1 = r1.data();
+    uint32_t* x2 = r2.data();
+    uint32_t* x3 = r3.data();
+    astd::parallelFor(parts, [=](size_t p) {
+        for (size_t i = wn * p / parts; i < wn * (p + 1) / parts; ++i) {
+            uint32_t v1 = x1[i];
+            uint32_t v2 = nttMul<P2>(nttSub<P2>(x2[i], v1 % P2), i12);
+            x3[i] = nttMul<P3>(nttSub<P3>(nttMul<P3>(nttSub<P3>(x3[i], v1 % P3), i13), v2 % P3), i23);
+            x2[i] = v2;
+        }
+    });
+    const uint64_t P12 = static_cast<uint64_t>(P1) * P2;
+    const uint64_t ph  = P12 / B;
+    const uint64_t pl  = P12 % B;
+    uint64_t carry = 0;
+    for (size_t i = 0; i < wn; ++i) {
+        uint32_t v1 = r1[i];
+        uint32_t v2 = r2[i];
+        uint32_t v3 = r3[i];
+        // add x + carry to w[i] without overflowing 64 bit:
+        // x + carry = (v1 + v2 * P1 + carry + v3 * pl) + v3 * ph * B
+        uint64_t q = v1 + static_cast<uint64_t>(v2) * P1 + carry + static_cast<uint64_t>(v3) * pl;
+        w[i]  = static_cast<T>(q % B);
+        carry = q / B + static_cast<uint64_t>(v3) * ph;
+    }
+    w[wn] = static_cast<T>(carry);
+}
+
+} // end of namespace
+
+namespace astd {
+
+size_t aint::impl::nttLength(size_t m, size_t n) {
+    // the transforms work on S * (m + n) - 1 coefficients, where S is the
+    // number of half components per single component (see operatorTimesNTT)
+#if defined(SINGLE_64)
+    const size_t S = 2;
+#else
+    const size_t S = 1;
+#endif
+    size_t L = 1;
+    while (L < S * (m + n) - 1) {
+        L *= 2;
+    }
+    return(L);
+}
+
+bool aint::impl::operatorTimesNTT(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n) {
+    // multiply with the number-theoretic transform, the convolution of single
+    // components of base B = C_SINGLE_COMP_MAX_P1 must not exceed P1 * P2 * P3;
+    // for SINGLE_64 (B^2 > P1 * P2 * P3) the single components are split into
+    // two half components of base H = sqrt(B) which are multiplied instead
+    const size_t L = nttLength(m, n);
+    if (L > C_NTT_MAX_LENGTH) {
+        return(false);
+    }
+    const size_t parts = threadParts(n, L);
+#if defined(SINGLE_64)
+#if defined(BINARY_RADIX)
+    const uint64_t H = uint64_t(1) << (C_SINGLE_COMP_WIDTH / 2);
+#else
+    const uint64_t H = constPower(10, C_SINGLE_COMP_WIDTH / 2);
+#endif
+    const bool square = (u == v && m == n);
+    scratchBuffer<uint32_t> uh(2 * m), vh(square ? 0 : 2 * n), wh(2 * (m + n));
+    for (size_t i = 0; i < m; ++i) {
+        uh[2 * i]     = static_cast<uint32_t>(u[i] % H);
+        uh[2 * i + 1] = static_cast<uint32_t>(u[i] / H);
+    }
+    for (size_t i = 0; i < vh.size() / 2; ++i) {
+        vh[2 * i]     = static_cast<uint32_t>(v[i] % H);
+        vh[2 * i + 1] = static_cast<uint32_t>(v[i] / H);
+    }
+    nttTimes(wh.data(), uh.data(), 2 * m, (square ? uh.data() : vh.data()), 2 * n, L, parts, H);
+    for (size_t i = 0; i < m + n; ++i) {
+        w[i] = static_cast<singleComp>(wh[2 * i] + wh[2 * i + 1] * H);
+    }
+#else
+    nttTimes(w, u, m, v, n, L, parts, C_SINGLE_COMP_MAX_P1);
+#endif
+    return(true);
+}
+
+} // end of namespace astd
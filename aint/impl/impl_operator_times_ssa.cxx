@@ -0,0 +1,268 @@
+/*
+ *  This file is part of aint.
+ *
+ *  aint provides a C++ class for arbitrary long integers which can be
+ *  used the same way as the C/C++ integer types (e.g. int or long),
+ *  but has no restriction on the length (if there is enough memory).
+ *  Aim of this project is to include fast integer multiplications
+ *  like the Toom-Cook algorithm or the Schoenhage-Strassen algorithm.
+ *  Copyright (C) 2014 Mario Baumann (mario-baumann@web.de)
+ *
+ *  aint is free software: you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  aint is distributed in the hope that it will be useful, but
+ *  WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with aint.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************/
+
+// arbitrary long integer
+// impl_operator_times_ssa.cxx (Schoenhage-Strassen algorithm for operator times)
+
+#include "impl.hxx"
+#include <algorithm> // std::fill, std::copy
+#include <cmath>     // std::sqrt
+
+namespace astd {
+
+//
+// The Schoenhage-Strassen algorithm computes the cyclic convolution of the
+// pieces of both factors with a fast Fourier transform in the ring of
+// integers modulo B^K + 1. Since B^K = -1, the base B is a 2K-th root of
+// unity, so all twiddle factors are powers of B and every multiplication
+// with a twiddle factor is a cyclic shift of single components (with a
+// change of sign). Only the L pointwise products are real multiplications,
+// which are computed recursively by operatorTimesLimbs.
+// See also TAoCP, Vol 2, 4.3.3 and http://en.wikipedia.org/wiki/Schonhage-Strassen_algorithm
+//
+
+void aint::impl::ssaNormalise(singleComp* a, size_t K) {
+    // with a = h * B^K + l and B^K = -1 we get a = l - h
+    singleComp h = a[K];
+    if (h == 0) {
+        return;
+    }
+    const singleComp one = 1;
+    a[K] = 0;
+    if (limbsSub(a, a, K, &h, 1)) {
+        // l - h < 0, so add B^K + 1 (the subtraction has already added B^K)
+        limbsAdd(a, a, K + 1, &one, 1);
+    }
+}
+
+void aint::impl::ssaNegate(singleComp* a, size_t K) {
+    if (limbsSize(a, K + 1) == 0) {
+        return;
+    }
+    // -a = B^K + 1 - a = (B^K - 1 - a) + 2, where B^K - 1 - a is the complement of a
+    const singleComp two = 2;
+    bool top = (a[K] != 0);
+    for (size_t j = 0; j < K; ++j) {
+        a[j] = (top ? 0 : C_SINGLE_COMP_MAX_P1 - 1 - a[j]);
+    }
+    a[K] = 0;
+    if (top) {
+        // a == B^K == -1
+        a[0] = 1;
+        return;
+    }
+    limbsAdd(a, a, K + 1, &two, 1);
+}
+
+void aint::impl::ssaHalve(singleComp* a, size_t K) {
+    // B is even, so a is even if and only if a[0] is even
+    const singleComp one = 1;
+    if (a[0] % 2 != 0) {
+        // a = a + B^K + 1
+        limbsAdd(a, a, K + 1, &one, 1);
+        a[K] += 1;
+    }
+    doubleComp rem = 0;
+    for (size_t j = K + 1; j-- > 0; ) {
+        doubleComp tmp = rem * C_SINGLE_COMP_MAX_P1 + a[j];
+        a[j] = tmp / 2;
+        rem  = tmp % 2;
+    }
+}
+
+void aint::impl::ssaAdd(singleComp* y, const singleComp* a, const singleComp* b, size_t K) {
+    limbsAdd(y, a, K + 1, b, K + 1);
+    ssaNormalise(y, K);
+}
+
+void aint::impl::ssaSub(singleComp* y, const singleComp* a, const singleComp* b, size_t K) {
+    const singleComp one = 1;
+    if (limbsSub(y, a, K + 1, b, K + 1)) {
+        // a - b is in [-B^K, 0), so y[K] == B - 1 and y[0..K) == a - b + B^K,
+        // therefore a - b + B^K + 1 is y[0..K) + 1
+        y[K] = 0;
+        limbsAdd(y, y, K + 1, &one, 1);
+    }
+}
+
+void aint::impl::ssaShift(singleComp* y, const singleComp* a, size_t s, size_t K) {
+    const singleComp one = 1;
+    bool negative = false;
+    if (s >= K) {
+        // B^K = -1
+        s -= K;
+        negative = true;
+    }
+    if (a[K] != 0) {
+        // a == B^K == -1, so y = -B^s
+        std::fill(y, y + K + 1, 0);
+        y[s] = 1;
+        negative = !negative;
+    } else {
+        // with a = h * B^(K-s) + l we get a * B^s = l * B^s + h * B^K = l * B^s - h
+        std::fill(y, y + s, 0);
+        std::copy(a, a + K - s, y + s);
+        y[K] = 0;
+        if (limbsSub(y, y, K, a + K - s, s)) {
+            limbsAdd(y, y, K + 1, &one, 1);
+        }
+    }
+    if (negative) {
+        ssaNegate(y, K);
+    }
+}
+
+void aint::impl::ssaTimes(singleComp* y, const singleComp* a, const singleComp* b, size_t K, singleComp* t) {
+    const singleComp one = 1;
+    if (a[K] != 0) {
+        // a == -1
+        std::copy(b, b + K + 1, y);
+        ssaNegate(y, K);
+    } else if (b[K] != 0) {
+        // b == -1
+        std::copy(a, a + K + 1, y);
+        ssaNegate(y, K);
+    } else {
+        // with a * b = h * B^K + l we get a * b = l - h
+        operatorTimesLimbs(t, a, K, b, K);
+        std::copy(t, t + K, y);
+        y[K] = 0;
+        if (limbsSub(y, y, K, t + K, K)) {
+            limbsAdd(y, y, K + 1, &one, 1);
+        }
+    }
+}
+
+void aint::impl::operatorTimesSSA(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n) {
+    size_t N = m + n;
+    bool square = (u == v && m == n);
+
+    // choose the transform length L = 2^t, the size M of the pieces (so that the product
+    // has not more than L pieces) and the size K of the residues: each coefficient of the
+    // product is less than L * B^(2M), and K must be a multiple of L/2 to make B^(2K/L)
+    // an L-th root of unity; the costs of the transforms (about 3tLK) are balanced
+    // against the costs of the L pointwise products (about L K^1.5)
+    size_t t = 0;
+    size_t M = 0;
+    size_t K = 0;
+    double cost = 0.0;
+    for (size_t tj = 2; tj < 8 * sizeof(size_t) - 1 && (static_cast<size_t>(1) << tj) <= 2 * N; ++tj) {
+        size_t Lj = static_cast<size_t>(1) << tj;
+        size_t Mj = (N + Lj - 1) / Lj;
+        while ((m + Mj - 1) / Mj + (n + Mj - 1) / Mj - 1 > Lj) {
+            ++Mj;
+        }
+        size_t ej = 1;
+        for (size_t b = C_SINGLE_COMP_MAX_P1; b < Lj; b *= C_SINGLE_COMP_MAX_P1) {
+            ++ej;
+        }
+        size_t Kj = (2 * Mj + ej + Lj / 2 - 1) / (Lj / 2) * (Lj / 2);
+        double costj = static_cast<double>(Lj) * Kj * (3.0 * tj + std::sqrt(static_cast<double>(Kj)));
+        if (t == 0 || costj < cost) {
+            t = tj;
+            M = Mj;
+            K = Kj;
+            cost = costj;
+        }
+    }
+    size_t L = static_cast<size_t>(1) << t;
+    size_t K1 = K + 1;
+    size_t r = 2 * K / L; // omega = B^r
+
+    // split the factors into L pieces of size M
+    scratchBuffer<singleComp> U(L * K1, 0);
+    scratchBuffer<singleComp> V(square ? 0 : L * K1, 0);
+    for (size_t i = 0; i * M < m; ++i) {
+        std::copy(u + i * M, u + std::min(m, (i + 1) * M), U.begin() + i * K1);
+    }
+    for (size_t i = 0; !square && i * M < n; ++i) {
+        std::copy(v + i * M, v + std::min(n, (i + 1) * M), V.begin() + i * K1);
+    }
+
+    // forward transforms (decimation in frequency, the result is in bit-reversed order),
+    // squares need only one transform; the L / 2 butterflies of each stage and the
+    // pointwise products are split into parts threads (each with its own buffer T + 2K * p)
+    const size_t parts = threadParts(n, L);
+    scratchBuffer<singleComp> TT(parts * 2 * K);
+    singleComp* T = TT.data();
+    singleComp* X[2] = { U.data(), V.data() };
+    for (size_t x = 0; x < (square ? 1 : 2); ++x) {
+        singleComp* Y = X[x];
+        for (size_t h = L / 2; h >= 1; h /= 2) {
+            size_t step = (L / (2 * h)) * r;
+            parallelFor(parts, [T, Y, L, K, K1, h, step, parts](size_t p) {
+                singleComp* t = T + 2 * K * p;
+                for (size_t k = L / 2 * p / parts; k < L / 2 * (p + 1) / parts; ++k) {
+                    size_t j = k % h;
+                    singleComp* a = Y + (k / h * 2 * h + j) * K1;
+                    singleComp* b = a + h * K1;
+                    ssaSub(t, a, b, K);
+                    ssaAdd(a, a, b, K);
+                    ssaShift(b, t, j * step, K);
+                }
+            });
+        }
+    }
+
+    // pointwise multiplication
+    singleComp* Y = U.data();
+    const singleComp* Z = (square ? Y : V.data());
+    parallelFor(parts, [T, Y, Z, L, K, K1, parts](size_t p) {
+        for (size_t i = L * p / parts; i < L * (p + 1) / parts; ++i) {
+            ssaTimes(Y + i * K1, Y + i * K1, Z + i * K1, K, T + 2 * K * p);
+        }
+    });
+
+    // inverse transform (decimation in time, the result is in natural order)
+    for (size_t h = 1; h < L; h *= 2) {
+        size_t step = (L / (2 * h)) * r;
+        parallelFor(parts, [T, Y, L, K, K1, h, step, parts](size_t p) {
+            singleComp* t = T + 2 * K * p;
+            for (size_t k = L / 2 * p / parts; k < L / 2 * (p + 1) / parts; ++k) {
+                size_t j = k % h;
+                singleComp* a = Y + (k / h * 2 * h + j) * K1;
+                singleComp* b = a + h * K1;
+                ssaShift(t, b, (2 * K - j * step) % (2 * K), K);
+                ssaSub(b, a, t, K);
+                ssaAdd(a, a, t, K);
+            }
+        });
+    }
+
+    // divide by L and recompose the product
+    std::fill(w, w + N, 0);
+    for (size_t i = 0; i < L && i * M < N; ++i) {
+        singleComp* c = Y + i * K1;
+        for (size_t j = 0; j < t; ++j) {
+            ssaHalve(c, K);
+        }
+        size_t cn = limbsSize(c, K1);
+        if (cn > 0) {
+            limbsAdd(w + i * M, w + i * M, N - i * M, c, cn);
+        }
+    }
+}
+
+} // end of namespace astd
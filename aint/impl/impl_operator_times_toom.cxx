@@ -0,0 +1,369 @@
+/*
+ *  This file is part of aint.
+ *
+ *  aint provides a C++ class for arbitrary long integers which can be
+ *  used the same way as the C/C++ integer types (e.g. int or long),
+ *  but has no restriction on the length (if there is enough memory).
+ *  Aim of this project is to include fast integer multiplications
+ *  like the Toom-Cook algorithm or the Schoenhage-Strassen algorithm.
+ *  Copyright (C) 2014 Mario Baumann (mario-baumann@web.de)
+ *
+ *  aint is free software: you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  aint is distributed in the hope that it will be useful, but
+ *  WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with aint.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************/
+
+// arbitrary long integer
+// impl_operator_times_toom.cxx (Toom-Cook algorithms for operator times)
+
+#include "impl.hxx"
+#include <algorithm> // std::copy, std::fill, std::min, std::swap
+
+namespace astd {
+
+//
+// The Toom-Cook algorithms split both factors into r parts of k single
+// components, i.e. u(x) = u_(r-1) * x^(r-1) + ... + u_0 with x = B^k (and
+// likewise v(x)), evaluate u(x) and v(x) at 2r-1 points, multiply the values
+// pointwise and interpolate the product polynomial w(x) = u(x) * v(x).
+// See also TAoCP, Vol 2, 4.3.3 and http://en.wikipedia.org/wiki/Toom-Cook_multiplication
+//
+// The (signed) intermediate values of evaluation and interpolation are kept
+// as toomValues, i.e. a sign and a magnitude of a fixed number of single
+// components in the scratch arena: e = k + 1 for the values of the evaluation
+// (less than 15 * B^k) and l = 2e + 1 for the pointwise products and the
+// interpolation. The pointwise products are computed recursively by
+// operatorTimesLimbs (or operatorSquareLimbs), the divisions of the
+// interpolation are exact divisions by small constants. The squaring variants
+// evaluate only one polynomial and square the values.
+//
+
+void aint::impl::toomAdd(toomValue& w, const toomValue& u, const toomValue& v, size_t n) {
+    if (u.negative == v.negative) {
+        limbsAdd(w.d, u.d, n, v.d, n);
+        w.negative = u.negative;
+    } else if (limbsCmp(u.d, n, v.d, n) >= 0) {
+        limbsSub(w.d, u.d, n, v.d, n);
+        w.negative = u.negative;
+    } else {
+        limbsSub(w.d, v.d, n, u.d, n);
+        w.negative = v.negative;
+    }
+}
+
+void aint::impl::toomSub(toomValue& w, const toomValue& u, const toomValue& v, size_t n) {
+    toomValue m = { v.d, !v.negative };
+    toomAdd(w, u, m, n);
+}
+
+void aint::impl::toomTimes(toomValue& w, const toomValue& u, singleComp s, size_t n) {
+    limbsTimesSingle(w.d, u.d, n, s);
+    w.negative = u.negative;
+}
+
+void aint::impl::toomDivide(toomValue& w, const toomValue& u, singleComp s, size_t n) {
+    // the remainder is zero
+    limbsDivULL(w.d, u.d, n, s);
+    w.negative = u.negative;
+}
+
+void aint::impl::toomProduct(toomValue& w, const toomValue& u, const toomValue& v, size_t e, size_t l) {
+    // w[0..2e) = u[0..e) * v[0..e), squared if u is v
+    if (&u == &v) {
+        operatorSquareLimbs(w.d, u.d, e);
+    } else {
+        operatorTimesLimbs(w.d, u.d, e, v.d, e);
+    }
+    std::fill(w.d + 2 * e, w.d + l, 0);
+    w.negative = (u.negative != v.negative);
+}
+
+void aint::impl::toomSplit(toomValue* p, size_t r, const singleComp* u, size_t m, size_t k, singleComp* t) {
+    // p[j] = u[jk..jk+k) in t[je..je+e), e = k + 1, for j < r (zero beyond m)
+    size_t e = k + 1;
+    std::fill(t, t + r * e, 0);
+    for (size_t j = 0; j < r; ++j) {
+        size_t jk = std::min(m, j * k);
+        std::copy(u + jk, u + std::min(m, jk + k), t + j * e);
+        p[j].d = t + j * e;
+        p[j].negative = false;
+    }
+}
+
+void aint::impl::toomRecompose(singleComp* w, size_t wn, size_t k, const toomValue* c, size_t r, size_t l) {
+    // w = sum of c[j] * B^jk (the coefficients of the product are not negative)
+    std::fill(w, w + wn, 0);
+    for (size_t j = 0; j < r; ++j) {
+        size_t cn = limbsSize(c[j].d, l);
+        if (cn > 0) {
+            limbsAdd(w + j * k, w + j * k, wn - j * k, c[j].d, cn);
+        }
+    }
+}
+
+void aint::impl::toom3Evaluate(toomValue* p, const singleComp* u, size_t m, size_t k) {
+    // p[0..3) = u(1), u(-1), u(-2), where u(1) = (u0 + u2) + u1, u(-1) = (u0 + u2) - u1
+    // and u(-2) = 2 * (u(-1) + u2) - u0
+    size_t e = k + 1;
+    scratchBuffer<singleComp> t(3 * e);
+    toomValue s[3];
+    toomSplit(s, 3, u, m, k, t.data());
+    toomAdd(p[1], s[0], s[2], e);
+    toomAdd(p[0], p[1], s[1], e);
+    toomSub(p[1], p[1], s[1], e);
+    toomAdd(p[2], p[1], s[2], e);
+    toomTimes(p[2], p[2], 2, e);
+    toomSub(p[2], p[2], s[0], e);
+}
+
+void aint::impl::operatorTimesToom3(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n) {
+    // compute w = u * v with the Toom-3 algorithm using the points 0, 1, -1, -2 and infinity
+    // and the evaluation/interpolation sequence of M. Bodrato (see "Towards Optimal
+    // Toom-Cook Multiplication for Univariate and Multivariate Polynomials in
+    // Characteristic 2 and 0", WAIFI 2007)
+    size_t k = (m + 2) / 3;
+    size_t e = k + 1;
+    size_t l = 2 * e + 1;
+
+    // evaluation at 1, -1 and -2
+    scratchBuffer<singleComp> t(6 * e);
+    toomValue p[3];
+    toomValue q[3];
+    for (size_t j = 0; j < 3; ++j) {
+        p[j].d = t.data() + j * e;
+        q[j].d = t.data() + (3 + j) * e;
+    }
+    toom3Evaluate(p, u, m, k);
+    toom3Evaluate(q, v, n, k);
+
+    // pointwise multiplication, r[0] = u0 * v0 and r[4] = u2 * v2 (zero if v has no third part)
+    scratchBuffer<singleComp> s(5 * l, 0);
+    toomValue r[5];
+    for (size_t j = 0; j < 5; ++j) {
+        r[j].d = s.data() + j * l;
+        r[j].negative = false;
+    }
+    operatorTimesLimbs(r[0].d, u, k, v, k);
+    for (size_t j = 0; j < 3; ++j) {
+        toomProduct(r[j + 1], p[j], q[j], e, l);
+    }
+    if (m > 2 * k && n > 2 * k) {
+        operatorTimesLimbs(r[4].d, u + 2 * k, m - 2 * k, v + 2 * k, n - 2 * k);
+    }
+
+    toom3Interpolate(w, m + n, k, r, l);
+}
+
+void aint::impl::operatorSquareToom3(singleComp* w, const singleComp* u, size_t m) {
+    // compute w = u * u with the Toom-3 algorithm (see operatorTimesToom3)
+    size_t k = (m + 2) / 3;
+    size_t e = k + 1;
+    size_t l = 2 * e + 1;
+
+    // evaluation at 1, -1 and -2
+    scratchBuffer<singleComp> t(3 * e);
+    toomValue p[3];
+    for (size_t j = 0; j < 3; ++j) {
+        p[j].d = t.data() + j * e;
+    }
+    toom3Evaluate(p, u, m, k);
+
+    // pointwise squares
+    scratchBuffer<singleComp> s(5 * l, 0);
+    toomValue r[5];
+    for (size_t j = 0; j < 5; ++j) {
+        r[j].d = s.data() + j * l;
+        r[j].negative = false;
+    }
+    operatorSquareLimbs(r[0].d, u, k);
+    for (size_t j = 0; j < 3; ++j) {
+        toomProduct(r[j + 1], p[j], p[j], e, l);
+    }
+    if (m > 2 * k) {
+        operatorSquareLimbs(r[4].d, u + 2 * k, m - 2 * k);
+    }
+
+    toom3Interpolate(w, 2 * m, k, r, l);
+}
+
+void aint::impl::toom3Interpolate(singleComp* w, size_t wn, size_t k, toomValue* r, size_t l) {
+    // interpolation of w(x) = c4 x^4 + ... + c0 from r = w(0), w(1), w(-1), w(-2), w(inf),
+    // in place, so that r[j] becomes c_j
+    scratchBuffer<singleComp> t(l);
+    toomValue tmp = { t.data(), false };
+    toomSub(r[3], r[3], r[1], l);     // (w(-2) - w(1)) / 3
+    toomDivide(r[3], r[3], 3, l);
+    toomSub(r[1], r[1], r[2], l);     // (w(1) - w(-1)) / 2 = c1 + c3
+    toomDivide(r[1], r[1], 2, l);
+    toomSub(r[2], r[2], r[0], l);     // w(-1) - w(0) = -c1 + c2 - c3 + c4
+    toomSub(r[3], r[2], r[3], l);     // c3 = (r[2] - r[3]) / 2 + 2 * w(inf)
+    toomDivide(r[3], r[3], 2, l);
+    toomTimes(tmp, r[4], 2, l);
+    toomAdd(r[3], r[3], tmp, l);
+    toomAdd(r[2], r[2], r[1], l);     // c2 = r[2] + r[1] - w(inf)
+    toomSub(r[2], r[2], r[4], l);
+    toomSub(r[1], r[1], r[3], l);     // c1 = r[1] - c3
+
+    // recomposition
+    toomRecompose(w, wn, k, r, 5, l);
+}
+
+void aint::impl::toom4Evaluate(toomValue* p, const singleComp* u, size_t m, size_t k) {
+    // p[0..5) = u(1), u(-1), u(2), u(-2) and 8 * u(1/2) = 8 u0 + 4 u1 + 2 u2 + u3 from the
+    // even and odd parts u0 + u2, u1 + u3 and u0 + 4 u2, 2 * (u1 + 4 u3)
+    size_t e = k + 1;
+    scratchBuffer<singleComp> t(5 * e);
+    toomValue s[4];
+    toomSplit(s, 4, u, m, k, t.data());
+    toomValue h = { t.data() + 4 * e, false };
+    toomAdd(p[0], s[0], s[2], e);
+    toomAdd(p[1], s[1], s[3], e);
+    toomSub(p[1], p[0], p[1], e);
+    toomAdd(p[0], p[0], p[0], e);
+    toomSub(p[0], p[0], p[1], e);
+    toomTimes(h, s[2], 4, e);
+    toomAdd(p[2], s[0], h, e);
+    toomTimes(h, s[3], 4, e);
+    toomAdd(h, h, s[1], e);
+    toomTimes(h, h, 2, e);
+    toomSub(p[3], p[2], h, e);
+    toomAdd(p[2], p[2], h, e);
+    toomTimes(p[4], s[0], 2, e);
+    toomAdd(p[4], p[4], s[1], e);
+    toomTimes(p[4], p[4], 2, e);
+    toomAdd(p[4], p[4], s[2], e);
+    toomTimes(p[4], p[4], 2, e);
+    toomAdd(p[4], p[4], s[3], e);
+}
+
+void aint::impl::operatorTimesToom4(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n) {
+    // compute w = u * v with the Toom-4 algorithm using the points 0, 1, -1, 2, -2, 1/2 and infinity
+    size_t k = (m + 3) / 4;
+    size_t e = k + 1;
+    size_t l = 2 * e + 1;
+
+    // evaluation at 1, -1, 2, -2 and 1/2 (scaled by 2^3)
+    scratchBuffer<singleComp> t(10 * e);
+    toomValue p[5];
+    toomValue q[5];
+    for (size_t j = 0; j < 5; ++j) {
+        p[j].d = t.data() + j * e;
+        q[j].d = t.data() + (5 + j) * e;
+    }
+    toom4Evaluate(p, u, m, k);
+    toom4Evaluate(q, v, n, k);
+
+    // pointwise multiplication, r[0] = u0 * v0 and r[6] = u3 * v3 (zero if v has no fourth part)
+    scratchBuffer<singleComp> s(7 * l, 0);
+    toomValue r[7];
+    for (size_t j = 0; j < 7; ++j) {
+        r[j].d = s.data() + j * l;
+        r[j].negative = false;
+    }
+    operatorTimesLimbs(r[0].d, u, k, v, k);
+    for (size_t j = 0; j < 5; ++j) {
+        toomProduct(r[j + 1], p[j], q[j], e, l);
+    }
+    if (m > 3 * k && n > 3 * k) {
+        operatorTimesLimbs(r[6].d, u + 3 * k, m - 3 * k, v + 3 * k, n - 3 * k);
+    }
+
+    toom4Interpolate(w, m + n, k, r, l);
+}
+
+void aint::impl::operatorSquareToom4(singleComp* w, const singleComp* u, size_t m) {
+    // compute w = u * u with the Toom-4 algorithm (see operatorTimesToom4)
+    size_t k = (m + 3) / 4;
+    size_t e = k + 1;
+    size_t l = 2 * e + 1;
+
+    // evaluation at 1, -1, 2, -2 and 1/2 (scaled by 2^3)
+    scratchBuffer<singleComp> t(5 * e);
+    toomValue p[5];
+    for (size_t j = 0; j < 5; ++j) {
+        p[j].d = t.data() + j * e;
+    }
+    toom4Evaluate(p, u, m, k);
+
+    // pointwise squares
+    scratchBuffer<singleComp> s(7 * l, 0);
+    toomValue r[7];
+    for (size_t j = 0; j < 7; ++j) {
+        r[j].d = s.data() + j * l;
+        r[j].negative = false;
+    }
+    operatorSquareLimbs(r[0].d, u, k);
+    for (size_t j = 0; j < 5; ++j) {
+        toomProduct(r[j + 1], p[j], p[j], e, l);
+    }
+    if (m > 3 * k) {
+        operatorSquareLimbs(r[6].d, u + 3 * k, m - 3 * k);
+    }
+
+    toom4Interpolate(w, 2 * m, k, r, l);
+}
+
+void aint::impl::toom4Interpolate(singleComp* w, size_t wn, size_t k, toomValue* r, size_t l) {
+    // interpolation of w(x) = c6 x^6 + ... + c0 from r = w(0), w(1), w(-1), w(2), w(-2),
+    // 64 * w(1/2), w(inf), in place, so that r[j] becomes c_j (c0 = w(0) and c6 = w(inf));
+    // the even coefficients c2, c4 and the odd coefficients c1, c3, c5 are separated
+    scratchBuffer<singleComp> t(l);
+    toomValue tmp = { t.data(), false };
+    toomValue* c = r;
+    toomSub(c[2], r[1], r[2], l);     // o1 = (w(1) - w(-1)) / 2 = c1 + c3 + c5
+    toomDivide(c[2], c[2], 2, l);
+    toomSub(c[1], r[1], c[2], l);     // e1 = w(1) - o1 = c0 + c2 + c4 + c6
+    toomSub(c[4], r[3], r[4], l);     // o2 = (w(2) - w(-2)) / 4 = c1 + 4 c3 + 16 c5
+    toomDivide(c[4], c[4], 4, l);
+    toomTimes(tmp, c[4], 2, l);       // e2 = w(2) - 2 o2 = c0 + 4 c2 + 16 c4 + 64 c6
+    toomSub(c[3], r[3], tmp, l);
+    toomSub(c[1], c[1], c[0], l);     // a = e1 - c0 - c6 = c2 + c4
+    toomSub(c[1], c[1], c[6], l);
+    toomSub(c[3], c[3], c[0], l);     // b = (e2 - c0 - 64 c6) / 4 = c2 + 4 c4
+    toomTimes(tmp, c[6], 64, l);
+    toomSub(c[3], c[3], tmp, l);
+    toomDivide(c[3], c[3], 4, l);
+    toomSub(c[3], c[3], c[1], l);     // c4 = (b - a) / 3
+    toomDivide(c[3], c[3], 3, l);
+    toomSub(c[1], c[1], c[3], l);     // c2 = a - c4
+    // now c[1] = c2, c[2] = o1, c[3] = c4, c[4] = o2
+    toomTimes(tmp, c[0], 64, l);      // h = (64 w(1/2) - 64 c0 - 16 c2 - 4 c4 - c6) / 2 = 16 c1 + 4 c3 + c5
+    toomSub(c[5], r[5], tmp, l);
+    toomTimes(tmp, c[1], 16, l);
+    toomSub(c[5], c[5], tmp, l);
+    toomTimes(tmp, c[3], 4, l);
+    toomSub(c[5], c[5], tmp, l);
+    toomSub(c[5], c[5], c[6], l);
+    toomDivide(c[5], c[5], 2, l);
+    toomSub(c[4], c[4], c[2], l);     // s = (o2 - o1) / 3 = c3 + 5 c5
+    toomDivide(c[4], c[4], 3, l);
+    toomSub(c[5], c[5], c[2], l);     // t = (h - o1) / 3 = 5 c1 + c3
+    toomDivide(c[5], c[5], 3, l);
+    toomTimes(tmp, c[4], 4, l);       // c5 = (t + 4 s - 5 o1) / 15
+    toomAdd(c[5], c[5], tmp, l);
+    toomTimes(tmp, c[2], 5, l);
+    toomSub(c[5], c[5], tmp, l);
+    toomDivide(c[5], c[5], 15, l);
+    toomTimes(tmp, c[5], 5, l);       // c3 = s - 5 c5
+    toomSub(c[4], c[4], tmp, l);
+    toomSub(c[2], c[2], c[4], l);     // c1 = o1 - c3 - c5
+    toomSub(c[2], c[2], c[5], l);
+    // now c[1] = c2, c[2] = c1, c[3] = c4, c[4] = c3, c[5] = c5
+    std::swap(c[1], c[2]);
+    std::swap(c[3], c[4]);
+
+    // recomposition
+    toomRecompose(w, wn, k, c, 7, l);
+}
+
+} // end of namespace astd
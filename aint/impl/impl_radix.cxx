@@ -0,0 +1,188 @@
+/*
+ *  This file is part of aint.
+ *
+ *  aint provides a C++ class for arbitrary long integers which can be
+ *  used the same way as the C/C++ integer types (e.g. int or long),
+ *  but has no restriction on the length (if there is enough memory).
+ *  Aim of this project is to include fast integer multiplications
+ *  like the Toom-Cook algorithm or the Schoenhage-Strassen algorithm.
+ *  Copyright (C) 2014 Mario Baumann (mario-baumann@web.de)
+ *
+ *  aint is free software: you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  aint is distributed in the hope that it will be useful, but
+ *  WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with aint.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************/
+
+// arbitrary long integer
+// impl_radix.cxx (conversion between the binary radix and decimal components)
+
+#include "impl.hxx"
+
+#if defined(BINARY_RADIX)
+
+#include <algorithm> // std::copy, std::fill
+
+namespace {
+
+//
+// below this number of decimal components Horner's scheme is faster than
+// the divide and conquer conversion
+//
+const size_t C_RADIX_DC_THRESHOLD = 64;
+
+//
+// below this number of decimal components the repeated short division is
+// faster than the divide and conquer output (which divides by D^h)
+//
+const size_t C_RADIX_DC_OUTPUT_THRESHOLD = 512;
+
+} // end of namespace
+
+namespace astd {
+
+//
+// With BINARY_RADIX the single components have the base 2^C_SINGLE_COMP_WIDTH,
+// so decimal digits appear only at input and output: the decimal string is
+// split into decimal components of C_DECIMAL_WIDTH digits (base D = 10^C_DECIMAL_WIDTH),
+// which are converted by divide and conquer, i.e. x = hi * D^h + lo, where h is a
+// power of 2 and the powers D^h are computed by squaring (so the conversion uses
+// the fast multiplication algorithms). Since D < C_SINGLE_COMP_MAX_P1, n decimal
+// components fit into n single components. The output splits x the same way with
+// the fast division by D^h.
+//
+
+const aint::impl::data& aint::impl::radixPower(radixPowers& powers, size_t k) {
+    // powers.p[k] = D^(2^k), computed by squaring on first use
+    while (powers.size <= k) {
+        data& q = powers.p[powers.size];
+        if (powers.size == 0) {
+            q.resize(1, C_DECIMAL_MAX_P1);
+        } else {
+            const data& p = powers.p[powers.size - 1];
+            q.resizeUninitialised(2 * p.size());
+            operatorSquareLimbs(q.data(), p.data(), p.size());
+            q.resize(limbsSize(q.data(), q.size()));
+        }
+        ++powers.size;
+    }
+    return(powers.p[k]);
+}
+
+void aint::impl::decimalToLimbs(const singleComp* c, size_t n, singleComp* w, radixPowers& powers) {
+    std::fill(w, w + n, 0);
+    if (n <= C_RADIX_DC_THRESHOLD) {
+        // Horner's scheme
+        size_t wn = 0;
+        for (size_t j = n; j-- > 0; ) {
+            doubleComp carry = c[j];
+            for (size_t i = 0; i < wn; ++i) {
+                doubleComp tmp = static_cast<doubleComp>(w[i]) * C_DECIMAL_MAX_P1 + carry;
+                w[i]  = tmp % C_SINGLE_COMP_MAX_P1;
+                carry = tmp / C_SINGLE_COMP_MAX_P1;
+            }
+            if (carry > 0) {
+                w[wn++] = carry;
+            }
+        }
+        return;
+    }
+    // h = 2^k < n <= 2^(k+1) and p = D^h
+    size_t k = 0;
+    while ((static_cast<size_t>(2) << k) < n) {
+        ++k;
+    }
+    size_t h = static_cast<size_t>(1) << k;
+    const data& p = radixPower(powers, k);
+    scratchBuffer<singleComp> lo(h);
+    scratchBuffer<singleComp> hi(n - h);
+    decimalToLimbs(c,     h,     lo.data(), powers);
+    decimalToLimbs(c + h, n - h, hi.data(), powers);
+    size_t hn = limbsSize(hi.data(), n - h);
+    if (hn > 0) {
+        operatorTimesLimbs(w, hi.data(), hn, p.data(), p.size());
+    }
+    limbsAdd(w, w, n, lo.data(), h);
+}
+
+void aint::impl::limbsToDecimal(const singleComp* u, size_t m, singleComp* c, size_t n, radixPowers& powers) {
+    m = limbsSize(u, m);
+    if (n <= C_RADIX_DC_OUTPUT_THRESHOLD) {
+        // repeated short division by D, the remainders are the decimal components;
+        // each pass divides by D K times (the quotient of a division is divided
+        // again as soon as its next component is known), so the K divisions are
+        // independent of each other and can run in parallel in the processor
+        const size_t K = 8;
+        scratchBuffer<singleComp> t(m);
+        std::copy(u, u + m, t.begin());
+        std::fill(c, c + n, 0);
+        size_t cn = 0;
+        while (m > 0) {
+            productComp rem[K] = { 0 };
+            for (size_t j = m; j-- > 0; ) {
+                productComp x = t[j];
+                for (size_t k = 0; k < K; ++k) {
+                    productComp tmp = rem[k] * C_SINGLE_COMP_MAX_P1 + x;
+                    x      = tmp / C_DECIMAL_MAX_P1;
+                    rem[k] = tmp - x * C_DECIMAL_MAX_P1;
+                }
+                t[j] = static_cast<singleComp>(x);
+            }
+            // u < D^n, so the remainders above c[n - 1] are 0
+            for (size_t k = 0; k < K && cn < n; ++k) {
+                c[cn++] = static_cast<singleComp>(rem[k]);
+            }
+            m = limbsSize(t.data(), m);
+        }
+        return;
+    }
+    // h = 2^k < n <= 2^(k+1) and p = D^h, i.e. u = q * D^h + r, where r has
+    // h and q has n - h decimal components
+    size_t k = 0;
+    while ((static_cast<size_t>(2) << k) < n) {
+        ++k;
+    }
+    size_t h = static_cast<size_t>(1) << k;
+    const data& p = radixPower(powers, k);
+    size_t pn = p.size();
+    if (limbsCmp(u, m, p.data(), pn) < 0) {
+        limbsToDecimal(u, m, c, h, powers);
+        std::fill(c + h, c + n, 0);
+        return;
+    }
+    // divide with the fast division of the normalised operands (see operatorDivide)
+    singleComp d = C_SINGLE_COMP_MAX_P1 / (p[pn - 1] + 1);
+    scratchBuffer<singleComp> v(pn);
+    scratchBuffer<singleComp> r(m + 1);
+    scratchBuffer<singleComp> q(m - pn + 1);
+    limbsTimesSingle(v.data(), p.data(), pn, d);
+    r[m] = limbsTimesSingle(r.data(), u, m, d);
+    operatorDivideLimbs(q.data(), r.data(), m - pn, v.data(), pn);
+    limbsDivULL(r.data(), r.data(), pn, d);
+    limbsToDecimal(r.data(), pn,         c,     h,     powers);
+    limbsToDecimal(q.data(), m - pn + 1, c + h, n - h, powers);
+}
+
+void aint::impl::limbsToDecimal(const singleComp* u, size_t m, data& c) {
+    // B^m <= D^n, since log10(2) < 0.30103
+    size_t n = static_cast<size_t>(m * (0.30103 * C_SINGLE_COMP_WIDTH) / C_DECIMAL_WIDTH) + 1;
+    radixPowers powers;
+    c.resizeUninitialised(n);
+    limbsToDecimal(u, m, c.data(), n, powers);
+    // remove leading zeros
+    size_t cn = limbsSize(c.data(), n);
+    c.resize(cn > 0 ? cn : 1);
+}
+
+} // end of namespace astd
+
+#endif // BINARY_RADIX
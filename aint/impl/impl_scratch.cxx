@@ -0,0 +1,120 @@
+/*
+ *  This file is part of aint.
+ *
+ *  aint provides a C++ class for arbitrary long integers which can be
+ *  used the same way as the C/C++ integer types (e.g. int or long),
+ *  but has no restriction on the length (if there is enough memory).
+ *  Aim of this project is to include fast integer multiplications
+ *  like the Toom-Cook algorithm or the Schoenhage-Strassen algorithm.
+ *  Copyright (C) 2014 Mario Baumann (mario-baumann@web.de)
+ *
+ *  aint is free software: you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  aint is distributed in the hope that it will be useful, but
+ *  WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with aint.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************/
+
+
+// arbitrary long integer
+// impl_scratch.cxx (per-thread scratch memory for the temporaries of the kernels)
+
+#include "impl_scratch.hxx"
+#include "impl_memory.hxx"
+#include <algorithm> // std::max
+#include <cstddef>   // std::max_align_t
+#include <new>       // std::bad_alloc
+
+namespace astd {
+
+//
+// The scratch arena is a list of chunks which are used one after another.
+// If a temporary does not fit into the rest of the current chunk, the next
+// chunk is used (the chunks behind the current one are unused and replaced
+// if they are too small), the rest of the current chunk stays unused until
+// the arena is released to a position before it. If the arena is released
+// completely, several chunks are merged into one, so that the arena of a
+// thread consists of a single chunk of the peak size after a while.
+//
+
+namespace {
+
+// alignment of the temporaries (suitable for any type)
+const size_t C_SCRATCH_ALIGN = alignof(std::max_align_t);
+
+} // end of namespace
+
+const size_t scratchArena::C_CHUNK_SIZE;
+
+scratchArena& scratchArena::local() {
+    static thread_local scratchArena arena;
+    return(arena);
+}
+
+scratchArena::~scratchArena() {
+    for (size_t j = 0; j < chunks_.size(); ++j) {
+        memory::free(chunks_[j].base, chunks_[j].size);
+    }
+}
+
+void* scratchArena::allocate(size_t n) {
+    n = (n + C_SCRATCH_ALIGN - 1) / C_SCRATCH_ALIGN * C_SCRATCH_ALIGN;
+    if (!chunks_.empty() && offset_ + n <= chunks_[chunk_].size) {
+        void* p = chunks_[chunk_].base + offset_;
+        offset_ += n;
+        return(p);
+    }
+    // continue with the next chunk
+    size_t next = (chunks_.empty() ? 0 : chunk_ + 1);
+    if (next < chunks_.size() && chunks_[next].size < n) {
+        for (size_t j = next; j < chunks_.size(); ++j) {
+            memory::free(chunks_[j].base, chunks_[j].size);
+        }
+        chunks_.resize(next);
+    }
+    if (next == chunks_.size()) {
+        chunk c;
+        c.size = std::max(n, (chunks_.empty() ? C_CHUNK_SIZE : 2 * chunks_.back().size));
+        c.base = static_cast<char*>(memory::allocate(c.size));
+        chunks_.push_back(c);
+    }
+    chunk_  = next;
+    offset_ = n;
+    return(chunks_[next].base);
+}
+
+void scratchArena::release(const position& p) {
+    chunk_  = p.chunk;
+    offset_ = p.offset;
+    if (chunk_ == 0 && offset_ == 0 && chunks_.size() > 1) {
+        // merge the chunks into one for the next temporaries (release is called by
+        // dtors, so the chunks are kept if there is not enough memory)
+        size_t size = 0;
+        for (size_t j = 0; j < chunks_.size(); ++j) {
+            size += chunks_[j].size;
+        }
+        char* base = NULL;
+        try {
+            base = static_cast<char*>(memory::allocate(size));
+        } catch (const std::bad_alloc&) {
+        }
+        if (base != NULL) {
+            for (size_t j = 0; j < chunks_.size(); ++j) {
+                memory::free(chunks_[j].base, chunks_[j].size);
+            }
+            chunks_.resize(1);
+            chunks_[0].base = base;
+            chunks_[0].size = size;
+        }
+    }
+}
+
+} // end of namespace astd
@@ -0,0 +1,222 @@
+/*
+ *  This file is part of aint.
+ *
+ *  aint provides a C++ class for arbitrary long integers which can be
+ *  used the same way as the C/C++ integer types (e.g. int or long),
+ *  but has no restriction on the length (if there is enough memory).
+ *  Aim of this project is to include fast integer multiplications
+ *  like the Toom-Cook algorithm or the Schoenhage-Strassen algorithm.
+ *  Copyright (C) 2014 Mario Baumann (mario-baumann@web.de)
+ *
+ *  aint is free software: you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  aint is distributed in the hope that it will be useful, but
+ *  WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with aint.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************/
+
+// arbitrary long integer
+// impl_thread.cxx (multithreading)
+
+#include "impl.hxx"
+#include <condition_variable> // std::condition_variable
+#include <exception>          // std::exception_ptr
+#include <mutex>              // std::mutex
+#include <system_error>       // std::system_error
+#include <thread>             // std::thread
+#include <vector>             // std::vector
+
+namespace {
+
+// true in the worker threads and in threads which run a part of parallelFor
+thread_local bool parallelActive = false;
+
+//
+// worker threads of parallelFor, started by setThreads and kept until the number
+// of threads changes: the temporaries of the parts are allocated in the scratch
+// arenas of the workers (see scratchArena), which are kept between the calls
+// instead of being allocated again for the threads of each call; the calling
+// thread runs part 0 and takes the next parts like the workers, so all parts
+// run even if fewer workers could be started
+//
+class threadPool {
+
+public:
+    // ctor(s)
+    threadPool() : call_(NULL), f_(NULL), parts_(0), next_(0), pending_(0), generation_(0), stop_(false) {
+    }
+
+    // dtor
+    ~threadPool() {
+        this->resize(0);
+    }
+
+    //! stops the workers and starts n new ones (fewer if the system has no more threads)
+    void resize(size_t n);
+    //! runs the parts of parallelFor, returns false if there are no workers or they
+    //! run the parts of another thread
+    bool run(size_t parts, astd::partFunction call, const void* f);
+
+private:
+    threadPool(const threadPool&);
+    threadPool& operator=(const threadPool&);
+
+    //! loop of the workers
+    void work();
+    //! runs part p (lock is released meanwhile)
+    void runPart(std::unique_lock<std::mutex>& lock, size_t p);
+
+    //! held by the thread which runs the parts or resizes the pool
+    std::mutex busy_;
+    //! protects the members below
+    std::mutex mutex_;
+    //! signals the workers a new call or stop_
+    std::condition_variable start_;
+    //! signals the calling thread that all parts have finished
+    std::condition_variable done_;
+    std::vector<std::thread> workers_;
+    // current call: the parts [next_, parts_) are not started yet, pending_ parts not finished
+    astd::partFunction call_;
+    const void* f_;
+    size_t parts_;
+    size_t next_;
+    size_t pending_;
+    unsigned long long generation_;
+    bool stop_;
+    //! first exception of the parts (rethrown in the calling thread)
+    std::exception_ptr error_;
+};
+
+threadPool& pool() {
+    static threadPool p;
+    return(p);
+}
+
+void threadPool::resize(size_t n) {
+    std::lock_guard<std::mutex> busy(busy_);
+    if (n == workers_.size()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    start_.notify_all();
+    for (size_t t = 0; t < workers_.size(); ++t) {
+        workers_[t].join();
+    }
+    workers_.clear();
+    stop_ = false;
+    workers_.reserve(n);
+    try {
+        while (workers_.size() < n) {
+            workers_.emplace_back(&threadPool::work, this);
+        }
+    } catch (const std::system_error&) {
+        // no more threads available, the calling thread runs the remaining parts
+    }
+}
+
+bool threadPool::run(size_t parts, astd::partFunction call, const void* f) {
+    std::unique_lock<std::mutex> busy(busy_, std::try_to_lock);
+    if (!busy.owns_lock() || workers_.empty()) {
+        return(false);
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    call_    = call;
+    f_       = f;
+    parts_   = parts;
+    next_    = 1;
+    pending_ = parts;
+    ++generation_;
+    start_.notify_all();
+    parallelActive = true;
+    this->runPart(lock, 0);
+    while (next_ < parts_) {
+        this->runPart(lock, next_++);
+    }
+    parallelActive = false;
+    done_.wait(lock, [this] { return(pending_ == 0); });
+    std::exception_ptr error = error_;
+    error_ = std::exception_ptr();
+    lock.unlock();
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return(true);
+}
+
+void threadPool::work() {
+    parallelActive = true;
+    std::unique_lock<std::mutex> lock(mutex_);
+    unsigned long long seen = generation_;
+    for (;;) {
+        start_.wait(lock, [this, seen] { return(stop_ || generation_ != seen); });
+        if (stop_) {
+            return;
+        }
+        seen = generation_;
+        while (next_ < parts_) {
+            this->runPart(lock, next_++);
+        }
+    }
+}
+
+void threadPool::runPart(std::unique_lock<std::mutex>& lock, size_t p) {
+    std::exception_ptr error;
+    lock.unlock();
+    try {
+        call_(f_, p);
+    } catch (...) {
+        error = std::current_exception();
+    }
+    lock.lock();
+    if (error && !error_) {
+        error_ = error;
+    }
+    if (--pending_ == 0) {
+        done_.notify_one();
+    }
+}
+
+} // end of namespace
+
+namespace astd {
+
+void parallelFor(size_t parts, partFunction call, const void* f) {
+    // nested calls (the parts of an outer parallelFor already use all threads) and
+    // calls while the workers run the parts of another thread run sequentially
+    if (parts <= 1 || parallelActive || !pool().run(parts, call, f)) {
+        for (size_t p = 0; p < parts; ++p) {
+            call(f, p);
+        }
+    }
+}
+
+void aint::impl::setThreads(unsigned int threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    threads_ = (threads == 0 ? 1 : threads);
+    pool().resize(threads_ - 1);
+}
+
+size_t aint::impl::threadParts(size_t n, size_t len) {
+    size_t parts = 1;
+    if (n >= C_TIMES_THREADS_THRESHOLD) {
+        while (2 * parts <= threads_ && 4 * parts <= len) {
+            parts *= 2;
+        }
+    }
+    return(parts);
+}
+
+} // end of namespace astd
@@ -0,0 +1,189 @@
+/*
+ *  This file is part of aint.
+ *
+ *  aint provides a C++ class for arbitrary long integers which can be
+ *  used the same way as the C/C++ integer types (e.g. int or long),
+ *  but has no restriction on the length (if there is enough memory).
+ *  Aim of this project is to include fast integer multiplications
+ *  like the Toom-Cook algorithm or the Schoenhage-Strassen algorithm.
+ *  Copyright (C) 2014 Mario Baumann (mario-baumann@web.de)
+ *
+ *  aint is free software: you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  aint is distributed in the hope that it will be useful, but
+ *  WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with aint.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************/
+
+// arbitrary long integer
+// impl_tune.cxx (benchmarks for aint-tune)
+
+#include "impl.hxx"
+
+#if defined(AINT_TUNE)
+
+#include <algorithm> // std::copy, std::max
+#include <chrono>    // std::chrono
+#include <random>    // std::mt19937
+#include <thread>    // std::thread
+
+namespace astd {
+
+//
+// The thresholds are tuned like in GMP's tuneup: for each size n the products
+// are timed with threshold n (the faster algorithm is used at the top level
+// only, the recursive products are smaller) and with threshold n + 1. The
+// thresholds are tuned in the order of the dispatch in operatorTimesBalanced,
+// the algorithms which are not yet tuned are switched off. The divisions are
+// tuned the same way (see operatorDivideLimbs): the recursive division with
+// the quotient 2n / n, the division with Newton's reciprocal with 3n / n, the
+// smallest quotient for which it is used.
+//
+
+double aint::impl::tuneTime(size_t n, tuneOperation op) {
+    std::mt19937 gen(static_cast<std::mt19937::result_type>(n));
+    std::uniform_int_distribution<long long int> dist(0, C_SINGLE_COMP_MAX_P1 - 1);
+    data u(3 * n), v(n), w(3 * n);
+    for (size_t j = 0; j < 3 * n; ++j) {
+        u[j] = static_cast<singleComp>(dist(gen));
+    }
+    for (size_t j = 0; j < n; ++j) {
+        v[j] = static_cast<singleComp>(dist(gen));
+    }
+    const singleComp* x = (op == TUNE_SQUARE ? u.data() : v.data());
+    // the divisor is normalised and the dividend of l single components is below B^(l-1)
+    size_t l = (op == TUNE_DIVIDE_2N ? 2 * n : 3 * n);
+    v[n - 1] = v[n - 1] / 2 + C_SINGLE_COMP_MAX_P1 / 2;
+    data a(l);
+    // the best of three runs, each at least 10 ms
+    double best = 0;
+    for (int r = 0; r < 3; ++r) {
+        size_t count = 0;
+        double time = 0;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        do {
+            if (op == TUNE_TIMES || op == TUNE_SQUARE) {
+                operatorTimesLimbs(w.data(), u.data(), n, x, n);
+            } else {
+                std::copy(u.begin(), u.begin() + l, a.begin());
+                a[l - 1] = 0;
+                operatorDivideLimbs(w.data(), a.data(), l - n - 1, v.data(), n);
+            }
+            ++count;
+            time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        } while (time < 0.01);
+        if (r == 0 || time / count < best) {
+            best = time / count;
+        }
+    }
+    return(best);
+}
+
+void aint::impl::tuneThreshold(threshold& t, const char* name, size_t lo, size_t hi, tuneOperation op) {
+    // the faster algorithm has to win at two consecutive sizes
+    size_t first = hi;
+    int wins = 0;
+    for (size_t n = lo; n < hi && wins < 2; n += (n + 7) / 8) {
+        t = n + 1;
+        double slow = tuneTime(n, op);
+        t = n;
+        double fast = tuneTime(n, op);
+        if (fast < slow) {
+            if (wins++ == 0) {
+                first = n;
+            }
+        } else {
+            wins  = 0;
+            first = hi;
+        }
+    }
+    t = first;
+    std::clog << name << " = " << t << std::endl;
+}
+
+void aint::impl::tune(std::ostream& out) {
+    const timesAlgorithm algo    = timesAlgorithm_;
+    const unsigned int   threads = threads_;
+    const size_t never = static_cast<size_t>(-1) / 4;
+    timesAlgorithm_ = TIMES_AUTO;
+    setThreads(1);
+    C_TIMES_TOOM3_THRESHOLD = never;
+    C_TIMES_TOOM4_THRESHOLD = never;
+    C_TIMES_FFT_THRESHOLD   = never;
+    C_SQUARE_FFT_THRESHOLD  = never;
+    C_TIMES_NTT_THRESHOLD   = never;
+    C_TIMES_FFT_NTT_THRESHOLD  = never;
+    C_SQUARE_FFT_NTT_THRESHOLD = never;
+    C_TIMES_SSA_THRESHOLD   = never;
+    C_DIVIDE_BZ_THRESHOLD     = never;
+    C_DIVIDE_NEWTON_THRESHOLD = never;
+
+    // schoolbook multiplication, Karatsuba and Toom-Cook
+    tuneThreshold(C_TIMES_KARATSUBA_THRESHOLD,  "C_TIMES_KARATSUBA_THRESHOLD",  8, 1024, TUNE_TIMES);
+    tuneThreshold(C_SQUARE_KARATSUBA_THRESHOLD, "C_SQUARE_KARATSUBA_THRESHOLD", 8, 2048, TUNE_SQUARE);
+    tuneThreshold(C_TIMES_TOOM3_THRESHOLD, "C_TIMES_TOOM3_THRESHOLD", C_TIMES_KARATSUBA_THRESHOLD, 4096,  TUNE_TIMES);
+    tuneThreshold(C_TIMES_TOOM4_THRESHOLD, "C_TIMES_TOOM4_THRESHOLD", C_TIMES_TOOM3_THRESHOLD,     16384, TUNE_TIMES);
+
+    // Schoenhage-Strassen (the fallback of the number-theoretic transform), below
+    // 256 single components its pointwise products are longer than the factors
+    timesAlgorithm_ = TIMES_SSA;
+    tuneThreshold(C_TIMES_SSA_THRESHOLD, "C_TIMES_SSA_THRESHOLD", std::max<size_t>(C_TIMES_KARATSUBA_THRESHOLD, 256), 65536, TUNE_TIMES);
+    timesAlgorithm_ = TIMES_AUTO;
+
+    // number-theoretic transform and floating-point FFT (which is tried first)
+    tuneThreshold(C_TIMES_NTT_THRESHOLD,  "C_TIMES_NTT_THRESHOLD",  C_TIMES_KARATSUBA_THRESHOLD,  16384, TUNE_TIMES);
+    tuneThreshold(C_TIMES_FFT_THRESHOLD,  "C_TIMES_FFT_THRESHOLD",  C_TIMES_KARATSUBA_THRESHOLD,  16384, TUNE_TIMES);
+    tuneThreshold(C_SQUARE_FFT_THRESHOLD, "C_SQUARE_FFT_THRESHOLD", C_SQUARE_KARATSUBA_THRESHOLD, 16384, TUNE_SQUARE);
+
+    // number-theoretic transform instead of an FFT of more than twice its length
+    tuneThreshold(C_TIMES_FFT_NTT_THRESHOLD,  "C_TIMES_FFT_NTT_THRESHOLD",  std::max<size_t>(C_TIMES_NTT_THRESHOLD, C_TIMES_FFT_THRESHOLD),  262144, TUNE_TIMES);
+    tuneThreshold(C_SQUARE_FFT_NTT_THRESHOLD, "C_SQUARE_FFT_NTT_THRESHOLD", std::max<size_t>(C_TIMES_NTT_THRESHOLD, C_SQUARE_FFT_THRESHOLD), 262144, TUNE_SQUARE);
+
+    // recursive division and division with Newton's reciprocal (with the tuned products)
+    tuneThreshold(C_DIVIDE_BZ_THRESHOLD,     "C_DIVIDE_BZ_THRESHOLD",     8, 1024, TUNE_DIVIDE_2N);
+    tuneThreshold(C_DIVIDE_NEWTON_THRESHOLD, "C_DIVIDE_NEWTON_THRESHOLD", C_DIVIDE_BZ_THRESHOLD, 16384, TUNE_DIVIDE_3N);
+
+    // threads (only on hosts with more than one hardware thread)
+    const unsigned int hardware = std::thread::hardware_concurrency();
+    if (hardware > 1) {
+        setThreads(hardware);
+        tuneThreshold(C_TIMES_THREADS_THRESHOLD, "C_TIMES_THREADS_THRESHOLD", 1024, 262144, TUNE_TIMES);
+    }
+
+    timesAlgorithm_ = algo;
+    setThreads(threads);
+
+    out << "// aint_tune.hxx (thresholds generated by aint-tune)" << std::endl;
+#if defined(BINARY_RADIX)
+    out << "// single components: base 2^" << C_SINGLE_COMP_WIDTH;
+#else
+    out << "// single components: base 10^" << C_SINGLE_COMP_WIDTH;
+#endif
+    out << ", hardware threads: " << hardware << std::endl;
+    out << std::endl;
+    out << "#define AINT_TIMES_KARATSUBA_THRESHOLD  " << C_TIMES_KARATSUBA_THRESHOLD  << std::endl;
+    out << "#define AINT_SQUARE_KARATSUBA_THRESHOLD " << C_SQUARE_KARATSUBA_THRESHOLD << std::endl;
+    out << "#define AINT_TIMES_TOOM3_THRESHOLD      " << C_TIMES_TOOM3_THRESHOLD      << std::endl;
+    out << "#define AINT_TIMES_TOOM4_THRESHOLD      " << C_TIMES_TOOM4_THRESHOLD      << std::endl;
+    out << "#define AINT_TIMES_SSA_THRESHOLD        " << C_TIMES_SSA_THRESHOLD        << std::endl;
+    out << "#define AINT_TIMES_NTT_THRESHOLD        " << C_TIMES_NTT_THRESHOLD        << std::endl;
+    out << "#define AINT_TIMES_FFT_THRESHOLD        " << C_TIMES_FFT_THRESHOLD        << std::endl;
+    out << "#define AINT_SQUARE_FFT_THRESHOLD       " << C_SQUARE_FFT_THRESHOLD       << std::endl;
+    out << "#define AINT_TIMES_FFT_NTT_THRESHOLD    " << C_TIMES_FFT_NTT_THRESHOLD    << std::endl;
+    out << "#define AINT_SQUARE_FFT_NTT_THRESHOLD   " << C_SQUARE_FFT_NTT_THRESHOLD   << std::endl;
+    out << "#define AINT_DIVIDE_BZ_THRESHOLD        " << C_DIVIDE_BZ_THRESHOLD        << std::endl;
+    out << "#define AINT_DIVIDE_NEWTON_THRESHOLD    " << C_DIVIDE_NEWTON_THRESHOLD    << std::endl;
+    out << "#define AINT_TIMES_THREADS_THRESHOLD    " << C_TIMES_THREADS_THRESHOLD    << std::endl;
+}
+
+} // end of namespace astd
+
+#endif // AINT_TUNE
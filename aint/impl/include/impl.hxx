@@ -29,16 +29,23 @@
 #define IMPL_HXX
 
 #include "aint.hxx"
-#include <cstdint> // int32_t, ...
-#include <vector>  // std::vector
+#include "impl_memory.hxx"
+#include "impl_scratch.hxx"
+#include "impl_vector.hxx"
+#include <cstdint>    // int32_t, ...
 #include <iostream>
 
-#if ! defined(SINGLE_8) && ! defined(SINGLE_16) && ! defined(SINGLE_32)
+#if ! defined(SINGLE_8) && ! defined(SINGLE_16) && ! defined(SINGLE_32) && ! defined(SINGLE_64)
 #define SINGLE_32
 #endif
 
 namespace astd {
 
+//! returns b^e as constant expression (for the constants of aint::impl)
+constexpr long long int constPower(long long int b, int e) {
+    return(e == 0 ? 1 : b * constPower(b, e - 1));
+}
+
 class aint::impl {
 
 public:
@@ -52,19 +59,122 @@ public:
 #elif defined(SINGLE_32)
     typedef int32_t singleComp;
     typedef int64_t doubleComp;
+#elif defined(SINGLE_64)
+    typedef int64_t  singleComp;
+    typedef __int128 doubleComp;
+#endif
+
+    //! unsigned type which holds a product of two single components (and sums of them)
+#if defined(SINGLE_64)
+    typedef unsigned __int128 productComp;
+#else
+    typedef uint64_t productComp;
 #endif
 
-    //! decimal-width of a single component
-    static const int C_SINGLE_COMP_WIDTH;
+#if defined(BINARY_RADIX)
+    //! binary-width of a single component (the sum of two single components fits into a singleComp)
+    static const int C_SINGLE_COMP_WIDTH = 8 * sizeof(singleComp) - 2;
 
     //! maximum number (+ 1) of a single component
-    static const singleComp C_SINGLE_COMP_MAX_P1;
+    static const singleComp C_SINGLE_COMP_MAX_P1 = constPower(2, C_SINGLE_COMP_WIDTH);
+
+    //! decimal-width of the decimal components used for input and output (NOTE: 0.30103 ~= log10(2))
+    static const int C_DECIMAL_WIDTH = (int) (0.30103 * C_SINGLE_COMP_WIDTH);
+#else
+    //! decimal-width of a single component (the sum of two single components fits into a singleComp, NOTE: 0.30103 ~= log10(2))
+    static const int C_SINGLE_COMP_WIDTH = (int) (0.30103 * (8 * sizeof(singleComp) - 1));
+
+    //! maximum number (+ 1) of a single component
+    static const singleComp C_SINGLE_COMP_MAX_P1 = constPower(10, C_SINGLE_COMP_WIDTH);
+
+    //! decimal-width of the decimal components used for input and output (the single components)
+    static const int C_DECIMAL_WIDTH = C_SINGLE_COMP_WIDTH;
+#endif
+
+    //! maximum number (+ 1) of a decimal component
+    static const singleComp C_DECIMAL_MAX_P1 = constPower(10, C_DECIMAL_WIDTH);
+
+#if defined(AINT_TUNE)
+    //! type of the thresholds of the algorithms (aint-tune changes them at runtime)
+    typedef size_t threshold;
+#else
+    //! type of the thresholds of the algorithms
+    typedef const size_t threshold;
+#endif
+
+    //! number of partial products which can be summed up in a productComp (plus a single component)
+    static const size_t C_TIMES_COMBA_GROUP;
+
+    //! minimum size (in single components) of the shorter factor to use Karatsuba's algorithm
+    static threshold C_TIMES_KARATSUBA_THRESHOLD;
+
+    //! minimum size (in single components) of a square to use Karatsuba's algorithm
+    static threshold C_SQUARE_KARATSUBA_THRESHOLD;
+
+    //! minimum size (in single components) of the shorter factor to use the Toom-3 algorithm
+    static threshold C_TIMES_TOOM3_THRESHOLD;
+
+    //! minimum size (in single components) of the shorter factor to use the Toom-4 algorithm
+    static threshold C_TIMES_TOOM4_THRESHOLD;
+
+    //! minimum size (in single components) of the shorter factor to use the Schoenhage-Strassen algorithm
+    static threshold C_TIMES_SSA_THRESHOLD;
+
+    //! minimum size (in single components) of the shorter factor to use the number-theoretic transform
+    static threshold C_TIMES_NTT_THRESHOLD;
+
+    //! minimum size (in single components) of the shorter factor to use the floating-point FFT
+    static threshold C_TIMES_FFT_THRESHOLD;
+
+    //! minimum size (in single components) of a square to use the floating-point FFT
+    static threshold C_SQUARE_FFT_THRESHOLD;
+
+    //! minimum size (in single components) of the shorter factor to prefer the number-theoretic transform to a longer FFT
+    static threshold C_TIMES_FFT_NTT_THRESHOLD;
+
+    //! minimum size (in single components) of a square to prefer the number-theoretic transform to a longer FFT
+    static threshold C_SQUARE_FFT_NTT_THRESHOLD;
+
+    //! minimum size (in single components) of the divisor and the quotient to use the Burnikel-Ziegler division
+    static threshold C_DIVIDE_BZ_THRESHOLD;
+
+    //! minimum size (in single components) of the divisor and the quotient to divide with Newton's reciprocal
+    static threshold C_DIVIDE_NEWTON_THRESHOLD;
+
+    //! maximum ratio of the sizes of the longer and the shorter factor without splitting the longer one into blocks
+    static const size_t C_TIMES_UNBALANCED_RATIO;
+
+    //! algorithm for the multiplication of large factors (see aint::setTimesAlgorithm)
+    static timesAlgorithm timesAlgorithm_;
+
+    //! minimum size (in single components) of the shorter factor to multiply with more than one thread
+    static threshold C_TIMES_THREADS_THRESHOLD;
+
+    //! maximum number of threads for the multiplication of large factors (see aint::setThreads)
+    static unsigned int threads_;
 
     //! sign of integer, positive or zero (=\b true) or negative (=\b false)
     bool positive_;
 
+    //! number of single components stored without allocating memory (16 bytes, e.g. 4 for SINGLE_32)
+    static const size_t C_DATA_INLINE = 16 / sizeof(singleComp);
+
+    //! maximum number of single components of an unsigned long long int (which has up to 20 decimal digits)
+#if defined(BINARY_RADIX)
+    static const size_t C_ULL_COMPS = 8 * sizeof(unsigned long long int) / C_SINGLE_COMP_WIDTH + 1;
+#else
+    static const size_t C_ULL_COMPS = 20 / C_SINGLE_COMP_WIDTH + 1;
+#endif
+
+    //! maximum machine integer divisor of the short division (larger ones need 128-bit arithmetic)
+#if defined(__SIZEOF_INT128__)
+    static const unsigned long long int C_ULL_DIVISOR_MAX = ~0ULL;
+#else
+    static const unsigned long long int C_ULL_DIVISOR_MAX = C_SINGLE_COMP_MAX_P1 - 1;
+#endif
+
     //! typedef for data container which stores single components
-    typedef std::vector<singleComp> data;
+    typedef smallVector<singleComp, C_DATA_INLINE> data;
 
     //! data container which stores single components
     data data_;
@@ -72,6 +182,7 @@ public:
     // ctor(s)
     impl();
     impl(const impl& a); // copy ctor
+    impl(impl&& a);      // move ctor (a is 0 afterwards)
     impl(const char* s);
     impl(const std::string& s);
     impl(const int i);
@@ -84,16 +195,30 @@ public:
     // dtor
     ~impl();
 
+    impl& operator=(const impl& a);
+    impl& operator=(impl&& a); // a is 0 afterwards
+
+    //! allocates an impl (zero) together with room for \b capacity single components in one block,
+    //! so that the sign, the size and the single components are next to each other in memory
+    static impl* create(size_t capacity);
+    //! allocates a copy of \b a in one block (see above)
+    static impl* create(const impl& a);
+    //! destroys and frees an impl (allocated by new or by create)
+    static void destroy(impl* a);
+    //! allocates an impl with the memory functions (see aint::setMemoryFunctions)
+    static void* operator new(size_t size);
+    //! frees an impl of sizeof(impl) bytes (if its ctor throws, otherwise see destroy)
+    static void operator delete(void* p, size_t size);
+
+    //! returns a zero shared by the aints which have no impl (see aint::pimpl)
+    static const impl& zero();
+
     //! clears the data container and sets sign to \b true
     void clear();
 
     //! removes leading zeros from a data container
     void removeLeadingZeros();
 
-    //! resizes the data container to \b size and sets all components to zero
-    //! \param size New size of data container
-    void resizeAndZeroise(size_t size);
-
     //! ensure a zero has a positive sign
     void makeZeroPositive();
 
@@ -116,19 +241,247 @@ public:
     //
     void operatorTimesSingle(const aint& lhs, const singleComp rhs, aint& res) const;
     void operatorTimes(const aint& lhs, const aint& rhs, aint& res) const;
+    void operatorSquare(const aint& lhs, aint& res) const;
+    //
+    // helper functions for operators with a machine integer operand, which is passed as absolute
+    // value and sign (see absLL) and split into single components on the stack (see limbsULL), so
+    // that only the result is allocated; the results may be lhs (e.g. for operator+=)
+    //
+    //! returns abs(i) (also for the minimum of long long int)
+    static unsigned long long int absLL(const long long int i);
+    //! splits i into the single components v[0..C_ULL_COMPS) and returns their number (>= 1)
+    static size_t limbsULL(unsigned long long int i, singleComp* v);
+    //! returns the value of u[0..m), which has to fit into an unsigned long long int
+    static unsigned long long int limbsToULL(const singleComp* u, size_t m);
+    //! computes w[0..m) = u[0..m) / v and returns u[0..m) % v, where v <= C_ULL_DIVISOR_MAX
+    //! (w may be identical to u or NULL)
+    static unsigned long long int limbsDivULL(singleComp* w, const singleComp* u, size_t m, const unsigned long long int v);
+    //! compares abs(lhs) with rhs and returns -1, 0 or +1
+    int  operatorCmpAbsULL(const aint& lhs, const unsigned long long int rhs) const;
+    void operatorPlusULL(  const aint& lhs, const unsigned long long int rhs, const bool rhsPositive, aint& res) const;
+    void operatorTimesULL( const aint& lhs, const unsigned long long int rhs, const bool rhsPositive, aint& res) const;
+    //! computes quot = lhs / rhs (rounded towards zero)
+    void operatorDivideULL(const aint& lhs, const unsigned long long int rhs, const bool rhsPositive, aint& quot) const;
+    //! computes rem = lhs % rhs (rem has the sign of lhs)
+    void operatorModuloULL(const aint& lhs, const unsigned long long int rhs, aint& rem) const;
+    //! computes lhs = rhs * quot + rem for a machine integer lhs
+    void operatorDivideULL(const unsigned long long int lhs, const bool lhsPositive, const aint& rhs, aint& quot, aint& rem) const;
+
+    // helper functions working on plain arrays of single components
+    // (least significant component first, not necessarily without leading zeros)
+    //
+    //! returns the size of u[0..m) without leading zeros
+    static size_t limbsSize(const singleComp* u, size_t m);
+    //! compares u[0..m) with v[0..n) and returns -1, 0 or +1
+    static int limbsCmp(const singleComp* u, size_t m, const singleComp* v, size_t n);
+    //! computes w[0..m) = u[0..m) + v[0..n), where m >= n, and returns the carry
+    static singleComp limbsAdd(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n);
+    //! computes w[0..m) = u[0..m) - v[0..n), where m >= n, and returns the borrow
+    static singleComp limbsSub(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n);
+    //! computes w[0..m) = u[0..m) * v, where v is a single component, and returns the carry
+    static singleComp limbsTimesSingle(singleComp* w, const singleComp* u, size_t m, const singleComp v);
+    //! computes w[0..m) = w[0..m) - u[0..m) * v in one pass and returns the borrow (which is to be
+    //! subtracted from w[m]), where v is a single component
+    static singleComp limbsSubTimesSingle(singleComp* w, const singleComp* u, size_t m, const singleComp v);
+    //! sets a to the (non negative) value of u[0..m)
+    static void limbsToAint(const singleComp* u, size_t m, aint& a);
+    //! computes res = a * B^k, truncated toward zero if k < 0 (res may be a)
+    static void shiftComps(const aint& a, long k, aint& res);
+#if defined(BINARY_RADIX)
+    //! powers D^(2^k) (D = C_DECIMAL_MAX_P1) of the radix conversion, p[0..size) are computed (see radixPower)
+    struct radixPowers {
+        data   p[8 * sizeof(size_t)];
+        size_t size;
+        radixPowers() : size(0) {
+        }
+    };
+    //! converts the decimal components c[0..n) to the single components w[0..n) (see impl_radix.cxx)
+    static void decimalToLimbs(const singleComp* c, size_t n, singleComp* w, radixPowers& powers);
+    //! returns powers.p[k] = D^(2^k), the missing powers are computed
+    static const data& radixPower(radixPowers& powers, size_t k);
+    //! converts the single components u[0..m) < D^n to the n decimal components c[0..n) (with leading zeros)
+    static void limbsToDecimal(const singleComp* u, size_t m, singleComp* c, size_t n, radixPowers& powers);
+    //! converts the single components u[0..m) to the decimal components c (without leading zeros)
+    static void limbsToDecimal(const singleComp* u, size_t m, data& c);
+#endif
+    //
+    //! computes w[0..m+n) = u[0..m) * v[0..n) with the schoolbook algorithm (column by column)
+    static void operatorTimesBasecase(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n);
+    //! computes w[0..m+n) = u[0..m) * v[0..n) with Karatsuba's algorithm, where m >= n
+    static void operatorTimesKaratsuba(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n);
+    //! computes w[0..m+n) = u[0..m) * v[0..n) with the Toom-3 algorithm, where m >= n
+    static void operatorTimesToom3(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n);
+    //! computes w[0..m+n) = u[0..m) * v[0..n) with the Toom-4 algorithm, where m >= n
+    static void operatorTimesToom4(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n);
+    //! signed value of the Toom-Cook algorithms: sign and magnitude d of a fixed number of single components
+    struct toomValue {
+        singleComp* d;
+        bool negative;
+    };
+    //! computes w = u + v for toomValues of n single components (w may be u or v)
+    static void toomAdd(toomValue& w, const toomValue& u, const toomValue& v, size_t n);
+    //! computes w = u - v for toomValues of n single components (w may be u or v)
+    static void toomSub(toomValue& w, const toomValue& u, const toomValue& v, size_t n);
+    //! computes w = u * s for toomValues of n single components and a small s (w may be u)
+    static void toomTimes(toomValue& w, const toomValue& u, singleComp s, size_t n);
+    //! computes w = u / s for toomValues of n single components, where s is small and divides u (w may be u)
+    static void toomDivide(toomValue& w, const toomValue& u, singleComp s, size_t n);
+    //! computes w = u * v for the toomValues u, v of e and w of l >= 2e single components (a square if u is v)
+    static void toomProduct(toomValue& w, const toomValue& u, const toomValue& v, size_t e, size_t l);
+    //! sets p[0..r) to the parts of k single components of u[0..m), copied to t[0..r(k+1)) with leading zeros
+    static void toomSplit(toomValue* p, size_t r, const singleComp* u, size_t m, size_t k, singleComp* t);
+    //! computes w[0..wn) = sum of c[j] * B^jk for j < r, where c[j] are the (non negative) toomValues of l single components
+    static void toomRecompose(singleComp* w, size_t wn, size_t k, const toomValue* c, size_t r, size_t l);
+    //! evaluates the parts of k single components of u[0..m) at 1, -1 and -2 (Toom-3), p[j] has k + 1 single components
+    static void toom3Evaluate(toomValue* p, const singleComp* u, size_t m, size_t k);
+    //! interpolates and recomposes w[0..wn) from the values r[0..5) at 0, 1, -1, -2 and infinity (Toom-3, parts of k single components)
+    static void toom3Interpolate(singleComp* w, size_t wn, size_t k, toomValue* r, size_t l);
+    //! evaluates the parts of k single components of u[0..m) at 1, -1, 2, -2 and 1/2 (Toom-4, scaled by 2^3), p[j] has k + 1 single components
+    static void toom4Evaluate(toomValue* p, const singleComp* u, size_t m, size_t k);
+    //! interpolates and recomposes w[0..wn) from the values r[0..7) at 0, 1, -1, 2, -2, 1/2 and infinity (Toom-4, parts of k single components)
+    static void toom4Interpolate(singleComp* w, size_t wn, size_t k, toomValue* r, size_t l);
+    //! computes w[0..m+n) = u[0..m) * v[0..n) with the Schoenhage-Strassen algorithm
+    static void operatorTimesSSA(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n);
+    //! computes w[0..m+n) = u[0..m) * v[0..n) with a number-theoretic transform over three primes,
+    //! returns \b false (and leaves w untouched) if the factors are too long for the transform
+    static bool operatorTimesNTT(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n);
+    //! returns the length of the number-theoretic transforms for a product of m and n single components
+    static size_t nttLength(size_t m, size_t n);
+    //! computes w[0..m+n) = u[0..m) * v[0..n) with a floating-point FFT, returns \b false
+    //! (and leaves w untouched) if the rounding error bound cannot guarantee an exact result
+    static bool operatorTimesFFT(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n);
+    //
+    // helper functions for the Schoenhage-Strassen algorithm working on residues
+    // modulo B^K + 1 (B = C_SINGLE_COMP_MAX_P1), which are stored in K + 1 single components
+    //
+    //! reduces a[0..K] (where a[K] may be any single component) to the range [0, B^K]
+    static void ssaNormalise(singleComp* a, size_t K);
+    //! computes a = -a
+    static void ssaNegate(singleComp* a, size_t K);
+    //! computes a = a / 2
+    static void ssaHalve(singleComp* a, size_t K);
+    //! computes y = a + b (y may be identical to a or b)
+    static void ssaAdd(singleComp* y, const singleComp* a, const singleComp* b, size_t K);
+    //! computes y = a - b (y may be identical to a or b)
+    static void ssaSub(singleComp* y, const singleComp* a, const singleComp* b, size_t K);
+    //! computes y = a * B^s, where 0 <= s < 2K (y must not be identical to a)
+    static void ssaShift(singleComp* y, const singleComp* a, size_t s, size_t K);
+    //! computes y = a * b, where t is a buffer of 2K single components (y may be identical to a or b)
+    static void ssaTimes(singleComp* y, const singleComp* a, const singleComp* b, size_t K, singleComp* t);
+    //! computes w[0..m+n) = u[0..m) * v[0..n), where m >= n, by splitting u into blocks of a few times n single components
+    static void operatorTimesUnbalanced(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n);
+    //! returns the smallest size of the shorter factor for the transforms of the selected algorithm (fft: threshold of the floating-point FFT)
+    static size_t transformThreshold(size_t fft);
+    //! computes w[0..m+n) = u[0..m) * v[0..n), where m >= n, with the first transform of the selected algorithm whose
+    //! threshold n reaches (fft: threshold of the floating-point FFT), returns \b false if no transform is used
+    static bool operatorTimesTransform(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n, size_t fft);
+    //! computes w[0..m+n) = u[0..m) * v[0..n), where m >= n, with Karatsuba's algorithm or the Toom-Cook algorithms
+    static void operatorTimesToomCook(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n);
+    //! computes w[0..m+n) = u[0..m) * v[0..n), where m >= n, with the fastest algorithm for factors of similar size
+    static void operatorTimesBalanced(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n);
+    //! computes w[0..m+n) = u[0..m) * v[0..n) with the fastest algorithm for the given sizes
+    static void operatorTimesLimbs(singleComp* w, const singleComp* u, size_t m, const singleComp* v, size_t n);
+    //
+    //! computes w[0..2m) = u[0..m) * u[0..m) with the schoolbook algorithm (using the symmetry of the partial products)
+    static void operatorSquareBasecase(singleComp* w, const singleComp* u, size_t m);
+    //! computes w[0..2m) = u[0..m) * u[0..m) with Karatsuba's algorithm
+    static void operatorSquareKaratsuba(singleComp* w, const singleComp* u, size_t m);
+    //! computes w[0..2m) = u[0..m) * u[0..m) with the Toom-3 algorithm
+    static void operatorSquareToom3(singleComp* w, const singleComp* u, size_t m);
+    //! computes w[0..2m) = u[0..m) * u[0..m) with the Toom-4 algorithm
+    static void operatorSquareToom4(singleComp* w, const singleComp* u, size_t m);
+    //! computes w[0..2m) = u[0..m) * u[0..m) with Karatsuba's algorithm or the Toom-Cook algorithms
+    static void operatorSquareToomCook(singleComp* w, const singleComp* u, size_t m);
+    //! computes w[0..2m) = u[0..m) * u[0..m) with the fastest algorithm for the given size
+    static void operatorSquareLimbs(singleComp* w, const singleComp* u, size_t m);
+    //! sets threads_ (0 = number of hardware threads) and starts threads_ - 1 worker threads for parallelFor
+    static void setThreads(unsigned int threads);
+#if defined(AINT_TUNE)
+    //! operations timed by aint-tune: product, square and division of 2n or 3n by n single components
+    enum tuneOperation { TUNE_TIMES, TUNE_SQUARE, TUNE_DIVIDE_2N, TUNE_DIVIDE_3N };
+    //! returns the time (in seconds) of the operation op on operands with n single components
+    static double tuneTime(size_t n, tuneOperation op);
+    //! sets t to the smallest size in [lo, hi) from which on the operation op with t = n is faster than with t = n + 1 (or to hi)
+    static void tuneThreshold(threshold& t, const char* name, size_t lo, size_t hi, tuneOperation op);
+    //! benchmarks the algorithms and writes their thresholds as C++ header to out (see aint::tune)
+    static void tune(std::ostream& out);
+#endif
+    //! returns the number of threads (a power of 2, at most threads_ and len / 2) for a product with the shorter factor of size n
+    static size_t threadParts(size_t n, size_t len);
     //
-    void operatorDivideMinusLeft(aint& lhs, const aint& rhs, const int p);
-    bool operatorDivideLessLeft(aint& lhs, const aint& rhs, const int p);
     void operatorDivideSingle(const aint& lhs, const singleComp rhs, aint& quot, aint& rem) const;
     void operatorDivide(const aint& lhs, const aint& rhs, aint& quot, aint& rem) const;
+    //! computes quot = lhs / rhs and rem = lhs % rhs, quot or rem may be lhs or rhs or NULL (not computed)
+    void operatorDivide(const aint& lhs, const aint& rhs, aint* quot, aint* rem) const;
+    //! computes rem = lhs % mod with the reciprocal mu = floor(B^2n / abs(mod)) of the n single components
+    //! of mod (Barrett's reduction if abs(lhs) < B^2n, otherwise the long division), rem may be lhs
+    void operatorModuloBarrett(const aint& lhs, const aint& mod, const aint& mu, aint& rem) const;
+    //! divides u[0..m+n] by the normalised v[0..n) (n >= 2) with Knuth's algorithm D, where u[m..m+n] < B * v,
+    //! q[0..m] gets the quotient and u[0..n) the remainder
+    static void operatorDivideBasecase(singleComp* q, singleComp* u, size_t m, const singleComp* v, size_t n);
+    //! divides u[0..m+n] by the normalised v[0..n) like operatorDivideBasecase with the fastest algorithm
+    static void operatorDivideLimbs(singleComp* q, singleComp* u, size_t m, const singleComp* v, size_t n);
+    //! divides u[0..m+n] by the normalised v[0..n) like operatorDivideBasecase with the recursive
+    //! division of Burnikel and Ziegler
+    static void operatorDivideBZ(singleComp* q, singleComp* u, size_t m, const singleComp* v, size_t n);
+    //! divides a[0..2n) by the normalised v[0..n), where a[n..2n) < v, q[0..n) gets the quotient,
+    //! a[0..n) the remainder (Burnikel-Ziegler, n / 2 is even or less than C_DIVIDE_BZ_THRESHOLD)
+    static void bzDivide21(singleComp* q, singleComp* a, const singleComp* v, size_t n);
+    //! divides a[0..3h) by the normalised v[0..2h), where a[h..3h) < v, q[0..h) gets the quotient,
+    //! a[0..2h) the remainder (Burnikel-Ziegler)
+    static void bzDivide32(singleComp* q, singleComp* a, const singleComp* v, size_t h);
+    //! divides u[0..m+n] by the normalised v[0..n) like operatorDivideBasecase with Newton's reciprocal of v
+    static void operatorDivideNewton(singleComp* q, singleComp* u, size_t m, const singleComp* v, size_t n);
+    //! computes x = floor(B^2n / v) and r = B^2n - v * x for the normalised v[0..n) with Newton's iteration
+    static void operatorDivideReciprocal(const singleComp* v, size_t n, aint& x, aint& r);
+
+    //! returns false if m is not coprime to B and otherwise computes mi = -m^-1 mod B^n, where m has n
+    //! single components (see montgomeryReduce)
+    static bool montgomeryInverse(const aint& m, aint& mi);
+    //! computes w[0..n) = t[0..2n] / B^n mod v[0..n) (Montgomery's REDC) for t < v * B^n, where
+    //! x[0..n) = -v^-1 mod B^n (t is overwritten)
+    static void montgomeryReduce(singleComp* w, singleComp* t, const singleComp* v, size_t n, const singleComp* x);
+    //! computes w[0..n) = a[0..n) * b[0..n) / B^n mod v[0..n) for a, b < v (see montgomeryReduce),
+    //! w may be identical to a or b
+    static void montgomeryTimes(singleComp* w, const singleComp* a, const singleComp* b, const singleComp* v, size_t n, const singleComp* x);
+    //! computes res = a * b / B^n mod m with mi = -m^-1 mod B^n (see montgomeryInverse), where a and b
+    //! are reduced modulo m before if they are not in [0, m), res may be a or b
+    static void montgomeryTimes(const aint& a, const aint& b, const aint& m, const aint& mi, aint& res);
 
     aint operatorPower(const aint& base, const aint& exp) const;
+    //! computes base^exp % mod (see aint::powmod)
+    aint operatorPowerModulo(const aint& base, const aint& exp, const aint& mod) const;
     aint operatorPowerTower(const aint& base, const aint& ord) const;
 
     aint factorialIterative(const aint& n) const;
     aint factorialRecursiveProduct(const aint& start, const aint& width) const;
 };
 
+inline aint::impl* aint::pimpl() {
+    if (!impl_) {
+        impl_.reset(impl::create(0));
+    }
+    return(impl_.get());
+}
+
+inline const aint::impl* aint::pimpl() const {
+    return(impl_ ? impl_.get() : &impl::zero());
+}
+
+//! runs part p of parallelFor, f points to the function object
+typedef void (*partFunction)(const void* f, size_t p);
+
+//! calls call(f, 0), ..., call(f, parts - 1) in the worker threads started by aint::setThreads
+//! (part 0 in the calling thread), nested calls run sequentially
+void parallelFor(size_t parts, partFunction call, const void* f);
+
+//! calls f(0), ..., f(parts - 1) in parallel (see above), f is neither copied nor
+//! wrapped into a std::function, so starting the parts allocates no memory
+template <typename F>
+void parallelFor(size_t parts, const F& f) {
+    parallelFor(parts, [](const void* g, size_t p) { (*static_cast<const F*>(g))(p); }, &f);
+}
+
 } // end of namespace astd
 
 #endif /* IMPL_HXX */
@@ -0,0 +1,64 @@
+/*
+ *  This file is part of aint.
+ *
+ *  aint provides a C++ class for arbitrary long integers which can be
+ *  used the same way as the C/C++ integer types (e.g. int or long),
+ *  but has no restriction on the length (if there is enough memory).
+ *  Aim of this project is to include fast integer multiplications
+ *  like the Toom-Cook algorithm or the Schoenhage-Strassen algorithm.
+ *  Copyright (C) 2014 Mario Baumann (mario-baumann@web.de)
+ *
+ *  aint is free software: you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  aint is distributed in the hope that it will be useful, but
+ *  WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with aint.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************/
+
+// arbitrary long integer
+// impl_memory.hxx (memory functions for all memory of aint)
+
+#ifndef IMPL_MEMORY_HXX
+#define IMPL_MEMORY_HXX
+
+#include "aint.hxx"
+#include <cstddef> // size_t
+
+namespace astd {
+
+//! allocates, reallocates and frees memory with the functions set by aint::setMemoryFunctions
+//! (used for the single components, the impl objects and the chunks of the scratch arena)
+class memory {
+
+public:
+    //! returns \b size bytes, throws std::bad_alloc if there is not enough memory
+    static void* allocate(size_t size);
+    //! resizes \b p from \b oldSize to \b newSize bytes (see allocate)
+    static void* reallocate(void* p, size_t oldSize, size_t newSize);
+    //! frees \b p of \b size bytes
+    static void free(void* p, size_t size);
+
+    //! function which allocates memory
+    static aint::allocateFunction allocate_;
+    //! function which reallocates memory
+    static aint::reallocateFunction reallocate_;
+    //! function which frees memory
+    static aint::freeFunction free_;
+
+    //! default functions (operator new and delete)
+    static void* defaultAllocate(size_t size);
+    static void* defaultReallocate(void* p, size_t oldSize, size_t newSize);
+    static void  defaultFree(void* p, size_t size);
+};
+
+} // end of namespace astd
+
+#endif /* IMPL_MEMORY_HXX */
@@ -0,0 +1,144 @@
+/*
+ *  This file is part of aint.
+ *
+ *  aint provides a C++ class for arbitrary long integers which can be
+ *  used the same way as the C/C++ integer types (e.g. int or long),
+ *  but has no restriction on the length (if there is enough memory).
+ *  Aim of this project is to include fast integer multiplications
+ *  like the Toom-Cook algorithm or the Schoenhage-Strassen algorithm.
+ *  Copyright (C) 2014 Mario Baumann (mario-baumann@web.de)
+ *
+ *  aint is free software: you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  aint is distributed in the hope that it will be useful, but
+ *  WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with aint.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************/
+
+
+// arbitrary long integer
+// impl_scratch.hxx (per-thread scratch memory for the temporaries of the kernels)
+
+#ifndef IMPL_SCRATCH_HXX
+#define IMPL_SCRATCH_HXX
+
+#include <algorithm> // std::fill
+#include <cstddef>   // size_t
+#include <vector>    // std::vector
+
+namespace astd {
+
+//! bump allocator for the temporaries of the kernels, one per thread (see local): memory
+//! is released in the reverse order of its allocation (see scratchBuffer) and kept for
+//! the next temporaries, so repeated operations reach a fixed peak working set instead
+//! of allocating their temporaries on the heap again and again
+class scratchArena {
+
+public:
+    //! position in the arena (see mark and release)
+    struct position {
+        size_t chunk;
+        size_t offset;
+    };
+
+    //! returns the arena of the calling thread
+    static scratchArena& local();
+
+    // ctor(s)
+    scratchArena() : chunk_(0), offset_(0) {
+    }
+
+    // dtor
+    ~scratchArena();
+
+    //! returns \b n bytes aligned for any type, which are valid until the arena is released
+    //! to a position before them
+    void* allocate(size_t n);
+    //! returns the current position
+    position mark() const {
+        position p = { chunk_, offset_ };
+        return(p);
+    }
+    //! releases all memory allocated after position \b p (the chunks are kept)
+    void release(const position& p);
+
+private:
+    scratchArena(const scratchArena&);
+    scratchArena& operator=(const scratchArena&);
+
+    //! block of memory allocated on the heap
+    struct chunk {
+        char*  base;
+        size_t size;
+    };
+
+    //! minimum size of a chunk in bytes
+    static const size_t C_CHUNK_SIZE = 64 * 1024;
+
+    //! chunks in the order of their use
+    std::vector<chunk> chunks_;
+    //! index of the chunk in use
+    size_t chunk_;
+    //! number of bytes in use in chunks_[chunk_]
+    size_t offset_;
+};
+
+//! array of \b n trivially copyable values in the scratch arena of the calling thread,
+//! released by the dtor (so scratch buffers have to be destroyed in reverse order of
+//! their construction, which scopes do)
+template <typename T>
+class scratchBuffer {
+
+public:
+    // ctor(s)
+    explicit scratchBuffer(size_t n) : arena_(scratchArena::local()), mark_(arena_.mark()), size_(n) {
+        data_ = static_cast<T*>(arena_.allocate(n * sizeof(T)));
+    }
+    scratchBuffer(size_t n, const T& value) : arena_(scratchArena::local()), mark_(arena_.mark()), size_(n) {
+        data_ = static_cast<T*>(arena_.allocate(n * sizeof(T)));
+        std::fill(data_, data_ + n, value);
+    }
+
+    // dtor
+    ~scratchBuffer() {
+        arena_.release(mark_);
+    }
+
+    size_t size() const { return(size_); }
+
+    T*       data()       { return(data_); }
+    const T* data() const { return(data_); }
+
+    T&       operator[](size_t j)       { return(data_[j]); }
+    const T& operator[](size_t j) const { return(data_[j]); }
+
+    T*       begin()       { return(data_); }
+    const T* begin() const { return(data_); }
+    T*       end()         { return(data_ + size_); }
+    const T* end() const   { return(data_ + size_); }
+
+private:
+    scratchBuffer(const scratchBuffer&);
+    scratchBuffer& operator=(const scratchBuffer&);
+
+    //! arena of the thread which constructed the buffer
+    scratchArena& arena_;
+    //! position of the arena before the buffer
+    scratchArena::position mark_;
+    //! values
+    T* data_;
+    //! number of values
+    size_t size_;
+};
+
+} // end of namespace astd
+
+#endif /* IMPL_SCRATCH_HXX */
@@ -0,0 +1,261 @@
+/*
+ *  This file is part of aint.
+ *
+ *  aint provides a C++ class for arbitrary long integers which can be
+ *  used the same way as the C/C++ integer types (e.g. int or long),
+ *  but has no restriction on the length (if there is enough memory).
+ *  Aim of this project is to include fast integer multiplications
+ *  like the Toom-Cook algorithm or the Schoenhage-Strassen algorithm.
+ *  Copyright (C) 2014 Mario Baumann (mario-baumann@web.de)
+ *
+ *  aint is free software: you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  aint is distributed in the hope that it will be useful, but
+ *  WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with aint.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************/
+
+// arbitrary long integer
+// impl_vector.hxx (container of single components with an inline buffer)
+
+#ifndef IMPL_VECTOR_HXX
+#define IMPL_VECTOR_HXX
+
+#include "impl_memory.hxx"
+#include <algorithm> // std::max, std::fill
+#include <cstddef>   // size_t
+#include <cstring>   // std::memcpy
+#include <iterator>  // std::reverse_iterator
+
+namespace astd {
+
+//! vector of trivially copyable values which stores up to N values in an inline
+//! buffer and allocates memory on the heap (see memory) only if it grows beyond N
+//! values (the subset of the interface of std::vector used by aint::impl); instead of
+//! the inline buffer the vector can use a local buffer allocated together with
+//! the object which owns the vector (see setLocal)
+template <typename T, size_t N>
+class smallVector {
+
+public:
+    typedef T                                     value_type;
+    typedef T*                                    iterator;
+    typedef const T*                              const_iterator;
+    typedef std::reverse_iterator<iterator>       reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    // ctor(s)
+    smallVector() : data_(inline_), size_(0), capacity_(N), local_(inline_), localCapacity_(N) {
+    }
+    explicit smallVector(size_t n, const T& value = T()) : data_(inline_), size_(0), capacity_(N), local_(inline_), localCapacity_(N) {
+        this->resize(n, value);
+    }
+    smallVector(const T* first, const T* last) : data_(inline_), size_(0), capacity_(N), local_(inline_), localCapacity_(N) {
+        this->assign(first, last);
+    }
+    smallVector(const smallVector& a) : data_(inline_), size_(0), capacity_(N), local_(inline_), localCapacity_(N) {
+        this->assign(a.begin(), a.end());
+    }
+    //! takes over the heap buffer of a, values in the local buffer of a are copied (this
+    //! allocates only if they do not fit into the inline buffer, so it is not noexcept)
+    smallVector(smallVector&& a) : data_(inline_), size_(0), capacity_(N), local_(inline_), localCapacity_(N) {
+        this->moveFrom(a);
+    }
+
+    // dtor
+    ~smallVector() {
+        this->release();
+    }
+
+    smallVector& operator=(const smallVector& a) {
+        if (this != &a) {
+            this->assign(a.begin(), a.end());
+        }
+        return(*this);
+    }
+    //! takes over the heap buffer of a, values in the local buffer of a are copied into the
+    //! current buffer (this allocates only if they do not fit into it)
+    smallVector& operator=(smallVector&& a) {
+        if (this != &a) {
+            if (a.data_ != a.local_) {
+                this->release();
+            }
+            this->moveFrom(a);
+        }
+        return(*this);
+    }
+
+    size_t size() const     { return(size_); }
+    size_t capacity() const { return(capacity_); }
+    bool   empty() const    { return(size_ == 0); }
+
+    T*       data()       { return(data_); }
+    const T* data() const { return(data_); }
+
+    T&       operator[](size_t j)       { return(data_[j]); }
+    const T& operator[](size_t j) const { return(data_[j]); }
+    T&       back()       { return(data_[size_ - 1]); }
+    const T& back() const { return(data_[size_ - 1]); }
+
+    iterator               begin()         { return(data_); }
+    const_iterator         begin() const   { return(data_); }
+    const_iterator         cbegin() const  { return(data_); }
+    iterator               end()           { return(data_ + size_); }
+    const_iterator         end() const     { return(data_ + size_); }
+    const_iterator         cend() const    { return(data_ + size_); }
+    reverse_iterator       rbegin()        { return(reverse_iterator(this->end())); }
+    const_reverse_iterator crbegin() const { return(const_reverse_iterator(this->cend())); }
+    reverse_iterator       rend()          { return(reverse_iterator(this->begin())); }
+    const_reverse_iterator crend() const   { return(const_reverse_iterator(this->cbegin())); }
+
+    //! ensures a capacity of at least n values (the values are kept)
+    void reserve(size_t n) {
+        if (n > capacity_) {
+            this->reallocate(n);
+        }
+    }
+    //! resizes to n values, new values are set to value (the capacity is never reduced)
+    void resize(size_t n, const T& value = T()) {
+        if (n > capacity_) {
+            this->grow(n);
+        }
+        if (n > size_) {
+            std::fill(data_ + size_, data_ + n, value);
+        }
+        size_ = n;
+    }
+    //! resizes to n values, new values are not initialised (for values which are overwritten anyway)
+    void resizeUninitialised(size_t n) {
+        if (n > capacity_) {
+            this->grow(n);
+        }
+        size_ = n;
+    }
+    //! replaces the values by the values [first, last), which must not be part of the vector
+    void assign(const T* first, const T* last) {
+        size_t n = static_cast<size_t>(last - first);
+        size_ = 0;
+        if (n > capacity_) {
+            // the old values need not be kept
+            this->release();
+        }
+        this->reserve(n);
+        if (n > 0) {
+            std::memcpy(data_, first, n * sizeof(T));
+        }
+        size_ = n;
+    }
+    void push_back(const T& value) {
+        if (size_ == capacity_) {
+            T tmp = value; // value may be part of the vector
+            this->grow(size_ + 1);
+            data_[size_++] = tmp;
+        } else {
+            data_[size_++] = value;
+        }
+    }
+    void pop_back() {
+        --size_;
+    }
+    //! removes all values (the capacity is kept)
+    void clear() {
+        size_ = 0;
+    }
+    //! reduces the capacity to the size, the values are moved back to the local buffer if they fit
+    void shrink_to_fit() {
+        if (data_ == local_ || size_ == capacity_) {
+            return;
+        }
+        if (size_ <= localCapacity_) {
+            if (size_ > 0) {
+                std::memcpy(local_, data_, size_ * sizeof(T));
+            }
+            memory::free(data_, capacity_ * sizeof(T));
+            data_     = local_;
+            capacity_ = localCapacity_;
+        } else {
+            data_     = static_cast<T*>(memory::reallocate(data_, capacity_ * sizeof(T), size_ * sizeof(T)));
+            capacity_ = size_;
+        }
+    }
+    //! returns the number of values which fit into the local buffer (N unless setLocal is used)
+    size_t localCapacity() const { return(localCapacity_); }
+    //! uses local[0..n) (n >= N) instead of the inline buffer, e.g. memory behind the object
+    //! owning the vector, which must not be freed before the vector (the values are kept)
+    void setLocal(T* local, size_t n) {
+        if (data_ == local_) {
+            std::memcpy(local, data_, size_ * sizeof(T));
+            data_     = local;
+            capacity_ = n;
+        }
+        local_         = local;
+        localCapacity_ = n;
+    }
+
+private:
+    //! growth policy: enlarges the capacity to at least n values, but at least by a factor
+    //! of 2, so that a value which grows step by step is moved O(log(n)) times only
+    void grow(size_t n) {
+        this->reallocate(std::max(n, 2 * capacity_));
+    }
+    //! moves the values to a new buffer with capacity n (>= size_)
+    void reallocate(size_t n) {
+        if (data_ != local_) {
+            data_ = static_cast<T*>(memory::reallocate(data_, capacity_ * sizeof(T), n * sizeof(T)));
+        } else {
+            T* p = static_cast<T*>(memory::allocate(n * sizeof(T)));
+            if (size_ > 0) {
+                std::memcpy(p, data_, size_ * sizeof(T));
+            }
+            data_ = p;
+        }
+        capacity_ = n;
+    }
+    //! frees the heap buffer and switches back to the (empty) local buffer
+    void release() {
+        if (data_ != local_) {
+            memory::free(data_, capacity_ * sizeof(T));
+        }
+        data_     = local_;
+        size_     = 0;
+        capacity_ = localCapacity_;
+    }
+    //! takes over the values of a (which is empty afterwards and uses its local buffer again)
+    void moveFrom(smallVector& a) {
+        if (a.data_ == a.local_) {
+            this->assign(a.data_, a.data_ + a.size_);
+        } else {
+            data_     = a.data_;
+            capacity_ = a.capacity_;
+            size_     = a.size_;
+            a.data_     = a.local_;
+            a.capacity_ = a.localCapacity_;
+        }
+        a.size_ = 0;
+    }
+
+    //! values (local_ or a buffer on the heap)
+    T* data_;
+    //! number of values
+    size_t size_;
+    //! number of values which fit into data_
+    size_t capacity_;
+    //! buffer which is not allocated by the vector (inline_ unless setLocal is used)
+    T* local_;
+    //! number of values which fit into local_
+    size_t localCapacity_;
+    //! inline buffer for up to N values
+    T inline_[N];
+};
+
+} // end of namespace astd
+
+#endif /* IMPL_VECTOR_HXX */
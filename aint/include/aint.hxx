@@ -29,6 +29,7 @@
 #ifndef AINT_HXX
 #define AINT_HXX
 
+#include <cstddef>   // size_t
 #include <string>    // std::string
 #include <sstream>   // std::ostream
 #include <memory>    // std::unique_ptr
@@ -45,6 +46,11 @@ This class provides an arbitrary long integer which can be used the
 same way as the C/C++ integer types (e.g. int or long), but has no
 restriction on the length (if there is enough memory).
 
+The integer is stored in single components with a decimal radix (e.g.
+10^9 for 32 bit single components) or, if built with BINARY_RADIX, with
+the radix 2^30 (2^62 for 64 bit single components), since the single
+components are signed integers with two spare bits.
+
 int - example:
 @code
 void factorial(int n) {
@@ -82,7 +88,7 @@ public:
     // ctor(s)
     aint();
     aint(const aint& a);
-    aint(      aint&& a);
+    aint(      aint&& a) noexcept; // a moved-from aint is zero
     aint(const char*        s);
     aint(const std::string& s);
     aint(const int    i);
@@ -100,7 +106,7 @@ public:
 
     // assignment operator(s)
     aint& operator=(const aint& rhs);
-    aint& operator=(      aint&& rhs);
+    aint& operator=(      aint&& rhs) noexcept;
     aint& operator=(const char*        s);
     aint& operator=(const std::string& s);
     aint& operator=(const int    i);
@@ -201,81 +207,102 @@ public:
     friend bool operator>=(const intULL lhs, const aint& rhs);
 
     // plus operator(s)
-    const aint operator+(); // unary +
-    const aint operator+(const aint&  rhs) const;
-    const aint operator+(const int    rhs) const;
-    const aint operator+(const intL   rhs) const;
-    const aint operator+(const intLL  rhs) const;
-    const aint operator+(const intU   rhs) const;
-    const aint operator+(const intUL  rhs) const;
-    const aint operator+(const intULL rhs) const;
-    friend const aint operator+(const int    lhs, const aint& rhs);
-    friend const aint operator+(const intL   lhs, const aint& rhs);
-    friend const aint operator+(const intLL  lhs, const aint& rhs);
-    friend const aint operator+(const intU   lhs, const aint& rhs);
-    friend const aint operator+(const intUL  lhs, const aint& rhs);
-    friend const aint operator+(const intULL lhs, const aint& rhs);
+    aint operator+() const; // unary +
+    aint operator+(const aint&  rhs) const&;
+    aint operator+(const aint&  rhs) &&;      // the result reuses the expiring lhs
+    aint operator+(      aint&& rhs) const&;  // the result reuses the expiring rhs
+    aint operator+(      aint&& rhs) &&;
+    aint operator+(const int    rhs) const&;
+    aint operator+(const int    rhs) &&;
+    aint operator+(const intL   rhs) const&;
+    aint operator+(const intL   rhs) &&;
+    aint operator+(const intLL  rhs) const&;
+    aint operator+(const intLL  rhs) &&;
+    aint operator+(const intU   rhs) const&;
+    aint operator+(const intU   rhs) &&;
+    aint operator+(const intUL  rhs) const&;
+    aint operator+(const intUL  rhs) &&;
+    aint operator+(const intULL rhs) const&;
+    aint operator+(const intULL rhs) &&;
+    friend aint operator+(const int    lhs, const aint& rhs);
+    friend aint operator+(const intL   lhs, const aint& rhs);
+    friend aint operator+(const intLL  lhs, const aint& rhs);
+    friend aint operator+(const intU   lhs, const aint& rhs);
+    friend aint operator+(const intUL  lhs, const aint& rhs);
+    friend aint operator+(const intULL lhs, const aint& rhs);
 
     // minus operator(s)
-    const aint operator-(); // unary -
-    const aint operator-(const aint&  rhs) const;
-    const aint operator-(const int    rhs) const;
-    const aint operator-(const intL   rhs) const;
-    const aint operator-(const intLL  rhs) const;
-    const aint operator-(const intU   rhs) const;
-    const aint operator-(const intUL  rhs) const;
-    const aint operator-(const intULL rhs) const;
-    friend const aint operator-(const int    lhs, const aint& rhs);
-    friend const aint operator-(const intL   lhs, const aint& rhs);
-    friend const aint operator-(const intLL  lhs, const aint& rhs);
-    friend const aint operator-(const intU   lhs, const aint& rhs);
-    friend const aint operator-(const intUL  lhs, const aint& rhs);
-    friend const aint operator-(const intULL lhs, const aint& rhs);
+    aint operator-() const&; // unary -
+    aint operator-() &&;     // unary - (negates the expiring operand)
+    aint operator-(const aint&  rhs) const&;
+    aint operator-(const aint&  rhs) &&;      // the result reuses the expiring lhs
+    aint operator-(      aint&& rhs) const&;  // the result reuses the expiring rhs
+    aint operator-(      aint&& rhs) &&;
+    aint operator-(const int    rhs) const&;
+    aint operator-(const int    rhs) &&;
+    aint operator-(const intL   rhs) const&;
+    aint operator-(const intL   rhs) &&;
+    aint operator-(const intLL  rhs) const&;
+    aint operator-(const intLL  rhs) &&;
+    aint operator-(const intU   rhs) const&;
+    aint operator-(const intU   rhs) &&;
+    aint operator-(const intUL  rhs) const&;
+    aint operator-(const intUL  rhs) &&;
+    aint operator-(const intULL rhs) const&;
+    aint operator-(const intULL rhs) &&;
+    friend aint operator-(const int    lhs, const aint& rhs);
+    friend aint operator-(const intL   lhs, const aint& rhs);
+    friend aint operator-(const intLL  lhs, const aint& rhs);
+    friend aint operator-(const intU   lhs, const aint& rhs);
+    friend aint operator-(const intUL  lhs, const aint& rhs);
+    friend aint operator-(const intULL lhs, const aint& rhs);
 
     // times operator(s)
-    const aint operator*(const aint&  rhs) const;
-    const aint operator*(const int    rhs) const;
-    const aint operator*(const intL   rhs) const;
-    const aint operator*(const intLL  rhs) const;
-    const aint operator*(const intU   rhs) const;
-    const aint operator*(const intUL  rhs) const;
-    const aint operator*(const intULL rhs) const;
-    friend const aint operator*(const int    lhs, const aint& rhs);
-    friend const aint operator*(const intL   lhs, const aint& rhs);
-    friend const aint operator*(const intLL  lhs, const aint& rhs);
-    friend const aint operator*(const intU   lhs, const aint& rhs);
-    friend const aint operator*(const intUL  lhs, const aint& rhs);
-    friend const aint operator*(const intULL lhs, const aint& rhs);
+    aint operator*(const aint&  rhs) const;
+    aint operator*(const int    rhs) const;
+    aint operator*(const intL   rhs) const;
+    aint operator*(const intLL  rhs) const;
+    aint operator*(const intU   rhs) const;
+    aint operator*(const intUL  rhs) const;
+    aint operator*(const intULL rhs) const;
+    friend aint operator*(const int    lhs, const aint& rhs);
+    friend aint operator*(const intL   lhs, const aint& rhs);
+    friend aint operator*(const intLL  lhs, const aint& rhs);
+    friend aint operator*(const intU   lhs, const aint& rhs);
+    friend aint operator*(const intUL  lhs, const aint& rhs);
+    friend aint operator*(const intULL lhs, const aint& rhs);
 
     // divide operator(s)
-    const aint operator/(const aint&  rhs) const;
-    const aint operator/(const int    rhs) const;
-    const aint operator/(const intL   rhs) const;
-    const aint operator/(const intLL  rhs) const;
-    const aint operator/(const intU   rhs) const;
-    const aint operator/(const intUL  rhs) const;
-    const aint operator/(const intULL rhs) const;
-    friend const aint operator/(const int    lhs, const aint& rhs);
-    friend const aint operator/(const intL   lhs, const aint& rhs);
-    friend const aint operator/(const intLL  lhs, const aint& rhs);
-    friend const aint operator/(const intU   lhs, const aint& rhs);
-    friend const aint operator/(const intUL  lhs, const aint& rhs);
-    friend const aint operator/(const intULL lhs, const aint& rhs);
+    aint operator/(const aint&  rhs) const;
+    aint operator/(const int    rhs) const;
+    aint operator/(const intL   rhs) const;
+    aint operator/(const intLL  rhs) const;
+    aint operator/(const intU   rhs) const;
+    aint operator/(const intUL  rhs) const;
+    aint operator/(const intULL rhs) const;
+    friend aint operator/(const int    lhs, const aint& rhs);
+    friend aint operator/(const intL   lhs, const aint& rhs);
+    friend aint operator/(const intLL  lhs, const aint& rhs);
+    friend aint operator/(const intU   lhs, const aint& rhs);
+    friend aint operator/(const intUL  lhs, const aint& rhs);
+    friend aint operator/(const intULL lhs, const aint& rhs);
 
     // modulo operator(s)
-    const aint operator%(const aint&  rhs) const;
-    const aint operator%(const int    rhs) const;
-    const aint operator%(const intL   rhs) const;
-    const aint operator%(const intLL  rhs) const;
-    const aint operator%(const intU   rhs) const;
-    const aint operator%(const intUL  rhs) const;
-    const aint operator%(const intULL rhs) const;
-    friend const aint operator%(const int    lhs, const aint& rhs);
-    friend const aint operator%(const intL   lhs, const aint& rhs);
-    friend const aint operator%(const intLL  lhs, const aint& rhs);
-    friend const aint operator%(const intU   lhs, const aint& rhs);
-    friend const aint operator%(const intUL  lhs, const aint& rhs);
-    friend const aint operator%(const intULL lhs, const aint& rhs);
+    aint operator%(const aint&  rhs) const;
+    aint operator%(const int    rhs) const;
+    aint operator%(const intL   rhs) const;
+    aint operator%(const intLL  rhs) const;
+    aint operator%(const intU   rhs) const;
+    aint operator%(const intUL  rhs) const;
+    aint operator%(const intULL rhs) const;
+    class barrett; // reduction by a fixed modulus, see aint::barrett
+    aint operator%(const barrett& rhs) const;
+    friend aint operator%(const int    lhs, const aint& rhs);
+    friend aint operator%(const intL   lhs, const aint& rhs);
+    friend aint operator%(const intLL  lhs, const aint& rhs);
+    friend aint operator%(const intU   lhs, const aint& rhs);
+    friend aint operator%(const intUL  lhs, const aint& rhs);
+    friend aint operator%(const intULL lhs, const aint& rhs);
 
     // compound assignment operator(s) +=
     aint& operator+=(const aint&  rhs);
@@ -331,18 +358,19 @@ public:
     aint& operator%=(const intU   i);
     aint& operator%=(const intUL  i);
     aint& operator%=(const intULL i);
+    aint& operator%=(const barrett& rhs);
 
     // divide and modulo operator(s)
     typedef std::pair<aint, aint> adiv;
-    const adiv div(const aint& rhs) const; // computes quotient and remainder simultaneously
+    adiv div(const aint& rhs) const; // computes quotient and remainder simultaneously
 
     // increment operator(s)
     aint& operator++();
-    const aint operator++(int);
+    aint operator++(int);
 
     // decrement operator(s)
     aint& operator--();
-    const aint operator--(int);
+    aint operator--(int);
 
     // member functions
     //! dumps to a string
@@ -357,11 +385,154 @@ public:
     aint power(const aint& exp);
     //! computes the power tower
     aint powertower(const aint& ord);
+    //! computes the power modulo mod (the same result as power(exp) % mod, but each intermediate value
+    //! stays below mod^2, throws std::overflow_error if mod is zero)
+    aint powmod(const aint& exp, const aint& mod) const;
+    class montgomery; // multiplication modulo a fixed modulus, see aint::montgomery
+
+    // memory
+    //! reserves memory for values with up to \b digits decimal digits, e.g. for an accumulator
+    //! (the memory is kept by the compound assignments, see shrink_to_fit)
+    void reserve(size_t digits);
+    //! returns the number of decimal digits which fit into the reserved memory
+    size_t capacity() const;
+    //! frees the memory which is not needed for the current value
+    void shrink_to_fit();
+
+    // algorithm selection
+    //! algorithms for the multiplication of large factors
+    enum timesAlgorithm {
+        TIMES_AUTO, //!< the fastest algorithm for the given sizes (default)
+        TIMES_SSA,  //!< Schoenhage-Strassen algorithm
+        TIMES_NTT,  //!< number-theoretic transform over three primes
+        TIMES_FFT   //!< floating-point FFT (if its result is guaranteed to be exact)
+    };
+    //! selects the algorithm for the multiplication of large factors
+    static void setTimesAlgorithm(timesAlgorithm algo);
+    //! returns the algorithm for the multiplication of large factors
+    static timesAlgorithm getTimesAlgorithm();
+
+    // multithreading
+    //! sets the maximum number of threads for the multiplication of large factors (0 = number of hardware threads),
+    //! the worker threads are started here and kept for all products until the number is changed
+    static void setThreads(unsigned int threads);
+    //! returns the maximum number of threads for the multiplication of large factors
+    static unsigned int getThreads();
+    // memory management
+    //! allocates \b size bytes aligned for any type (returns NULL or throws std::bad_alloc if there is not enough memory)
+    typedef void* (*allocateFunction)(size_t size);
+    //! resizes the memory \b p of \b oldSize bytes to \b newSize bytes, keeping min(oldSize, newSize) bytes (see above)
+    typedef void* (*reallocateFunction)(void* p, size_t oldSize, size_t newSize);
+    //! frees the memory \b p of \b size bytes
+    typedef void  (*freeFunction)(void* p, size_t size);
+    //! sets the functions which allocate, reallocate and free all memory of aint (the single components,
+    //! the objects behind the aints and the temporaries of the algorithms), NULL selects the default
+    //! (operator new and delete); like the functions of GMP's mp_set_memory_functions they must be set
+    //! before the first aint is created, since memory is freed with the functions which are set then
+    static void setMemoryFunctions(allocateFunction allocate, reallocateFunction reallocate, freeFunction free);
+    //! returns the functions which allocate, reallocate and free the memory of aint (arguments may be NULL)
+    static void getMemoryFunctions(allocateFunction* allocate, reallocateFunction* reallocate, freeFunction* free);
+#if defined(AINT_TUNE)
+    //! benchmarks the algorithms on this host and writes their thresholds as C++ header (only for aint-tune)
+    static void tune(std::ostream& out);
+#endif
 
 private:
     // use pimpl idiom
     class impl; // forward declaration
-    std::unique_ptr<impl> impl_;
+    //! destroys an impl and frees its memory with the memory functions (see setMemoryFunctions)
+    struct implDeleter {
+        void operator()(impl* p) const;
+    };
+    std::unique_ptr<impl, implDeleter> impl_;
+    //! returns the impl (a moved-from aint has none and creates a zero impl when it is changed)
+    impl* pimpl();
+    //! returns the impl (a moved-from aint has none and returns a shared zero)
+    const impl* pimpl() const;
+};
+
+/*!
+@class aint::barrett
+
+@brief reduction by a fixed modulus (Barrett's method)
+
+A barrett object computes the reciprocal of its modulus once, so that
+a % r computes the same result as a % r.modulus(), but with two
+multiplications and a correction instead of a long division if
+abs(a) < r.modulus()^2 (e.g. for a product of two remainders).
+
+@code
+aint::barrett r(m);
+for (int j = 0; j < n; ++j) {
+    x = (x * y) % r;
+}
+@endcode
+*/
+class aint::barrett {
+
+public:
+    // ctor(s)
+    //! computes the reciprocal of m (throws std::overflow_error if m is zero)
+    explicit barrett(const aint& m);
+
+    //! returns the modulus
+    const aint& modulus() const;
+
+private:
+    friend class aint;
+    //! modulus
+    aint modulus_;
+    //! floor(B^2n / abs(modulus_)), where B^n is the smallest power of the radix of the single components above abs(modulus_)
+    aint reciprocal_;
+};
+
+/*!
+@class aint::montgomery
+
+@brief multiplication modulo a fixed modulus (Montgomery's method)
+
+A montgomery object represents the remainders a of its modulus m (of n
+single components with the radix B) by their Montgomery forms
+a * B^n % m, so that the product of two Montgomery forms is reduced
+without a division (Montgomery's REDC). The modulus has to be coprime
+to B (i.e. odd, and for the decimal radix no multiple of 5).
+
+@code
+aint::montgomery r(m);
+aint x = r.to(a);
+for (int j = 0; j < n; ++j) {
+    x = r.square(x);
+}
+a = r.from(x); // a^(2^n) % m
+@endcode
+*/
+class aint::montgomery {
+
+public:
+    // ctor(s)
+    //! computes the constants of m (throws std::overflow_error if m is zero and
+    //! std::invalid_argument if m is not coprime to the radix of the single components)
+    explicit montgomery(const aint& m);
+
+    //! returns the modulus (abs(m))
+    const aint& modulus() const;
+    //! returns the Montgomery form of a (of a % modulus() in [0, modulus()), also for a negative a)
+    aint to(const aint& a) const;
+    //! returns the remainder in [0, modulus()) of the Montgomery form x
+    aint from(const aint& x) const;
+    //! returns the Montgomery form of the product of the Montgomery forms x and y
+    //! (like all functions, which take Montgomery forms, x and y are taken modulo modulus())
+    aint times(const aint& x, const aint& y) const;
+    //! returns the Montgomery form of the square of the Montgomery form x
+    aint square(const aint& x) const;
+
+private:
+    //! modulus (positive)
+    aint modulus_;
+    //! -modulus_^-1 mod B^n, where modulus_ has n single components
+    aint inverse_;
+    //! B^2n % modulus_ (the Montgomery form of B^n % modulus_)
+    aint square_;
 };
 
 } // end of namespace astd
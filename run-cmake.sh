@@ -46,11 +46,14 @@ if [ "_$1" = "_" ]; then
     echo "    -i8 .... Uses int size  8 for single component"
     echo "    -i16 ... Uses int size 16 for single component"
     echo "    -i32 ... Uses int size 32 for single component"
+    echo "    -i64 ... Uses int size 64 for single component (not with -32)"
+    echo "    -b ..... Uses a binary radix for single component"
     exit 0
 fi
 
 BUILD_TYPE="Release"
 ARCH="64"
+BINARY_RADIX="OFF"
 while [ $# -gt 0 ]
 do
     case '_'$1 in
@@ -72,6 +75,12 @@ do
     _-i32)
         SINGLE_SIZE="32"
         ;;
+    _-i64)
+        SINGLE_SIZE="64"
+        ;;
+    _-b)
+        BINARY_RADIX="ON"
+        ;;
     *)
         SOURCE_DIR=$1
         ;;
@@ -100,6 +109,7 @@ run_cmake \
     -D "CMAKE_BUILD_TYPE=${BUILD_TYPE}" \
     -D "_ECLIPSE_VERSION=4.3" \
     -D "AINT_SINGLE_SIZE=${SINGLE_SIZE}" \
+    -D "AINT_BINARY_RADIX=${BINARY_RADIX}" \
     -D "CMAKE_CXX_COMPILER_ARG1=-std=c++11 -m${ARCH}" \
     -D "CMAKE_ECLIPSE_MAKE_ARGUMENTS=-j4 --no-print-directory" \
     -D "CMAKE_INSTALL_PREFIX=$(pwd)/install" \